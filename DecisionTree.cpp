@@ -0,0 +1,399 @@
+/******************************************
+* Author    : Bryan Estrada               *
+* Teacher   : Dr. Mark Lehr               *
+* Class     : CSC-17C                     *
+* Assignment: Project #1                  *
+* Title     : Mastermind Decision Trees   *
+******************************************/
+
+//Libraries
+#include "DecisionTree.h"
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <fcntl.h>      // POSIX open
+#include <sys/mman.h>   // mmap
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+/************************************************************
+* FUNCTION: treeSlots
+*____________________________________________________________
+* PURPOSE:
+*    Counts the hints possible at a code length: every pair
+*    of correct and misplaced counts adding up to at most
+*    the length.
+*
+* PARAMETERS:
+*    - int length: The code length.
+*____________________________________________________________
+* RETURNS:
+*    int: Child slots per tree node, 15 for 4 digits, 28 for
+*         6 and 45 for 8.
+************************************************************/
+int treeSlots(int length) {
+    return (length + 1) * (length + 2) / 2;
+}
+
+/************************************************************
+* FUNCTION: treeSlot
+*____________________________________________________________
+* PURPOSE:
+*    Numbers the hints of one code length densely, correct
+*    count first, so a node needs no unused child slots.
+*
+* PARAMETERS:
+*    - const Hint& hint: The hint to number.
+*    - int length: The code length.
+*____________________________________________________________
+* RETURNS:
+*    int: The hint's slot in [0, treeSlots(length)).
+************************************************************/
+int treeSlot(const Hint& hint, int length) {
+    int c = hint.correct;
+    return c * (length + 1) - c * (c - 1) / 2 + hint.misplaced;
+}
+
+/************************************************************
+* FUNCTION: compileTree
+*____________________________________________________________
+* PURPOSE:
+*    Plays a deterministic strategy against every secret at
+*    once, one tree level at a time. Each node owns the
+*    candidates consistent with the hints leading to it;
+*    worker threads pick the node's guess and score its
+*    candidates, then the candidates are split by hint, in
+*    order, into the next level's nodes. Children are
+*    numbered as they are found, giving a breadth-first
+*    layout. A hint that leaves one candidate becomes a
+*    TREE_LEAF word in the parent instead of a node, so the
+*    tree holds only the nodes that still have to split.
+*
+* PARAMETERS:
+*    - const CodeSpace& space: The setting to compile.
+*    - const string& strategyName: A deterministic strategy
+*                                  from strategyNames().
+*    - vector<uint32_t>& nodes: Receives the node array.
+*____________________________________________________________
+* RETURNS:
+*    bool: False if the strategy is unknown or random.
+************************************************************/
+bool compileTree(const CodeSpace& space, const string& strategyName,
+                 vector<uint32_t>& nodes) {
+    int length = space.length();
+    int slots = treeSlots(length);
+    int winSlot = treeSlot(Hint{length, 0}, length);
+    uint32_t stride = 1 + slots;
+    unsigned workers = max(1u, thread::hardware_concurrency());
+
+    // One strategy per worker; guessFor takes nothing from the arena
+    Arena arena(nullptr, 0);
+    unique_ptr<FeedbackTable> table;
+    if (space.size() <= MAX_FEEDBACK_CODES) {
+        table.reset(new FeedbackTable(space));
+    }
+    vector<unique_ptr<Strategy>> strategies;
+    for (unsigned w = 0; w < workers; w++) {
+        strategies.push_back(createStrategy(strategyName, 0, arena));
+        if (!dynamic_cast<CandidateStrategy*>(strategies.back().get()) ||
+            !strategies.back()->deterministic()) {
+            return false;
+        }
+        if (ScoringStrategy* scoring =
+                dynamic_cast<ScoringStrategy*>(strategies.back().get())) {
+            scoring->useTable(table.get());
+        }
+    }
+
+    // Node i of a level owns level[bounds[i]] up to level[bounds[i + 1]]
+    vector<Code> level(space.begin(), space.begin() + space.size());
+    vector<size_t> bounds = {0, level.size()};
+    nodes.clear();
+
+    while (bounds.size() > 1) {
+        size_t count = bounds.size() - 1;
+        uint32_t first = static_cast<uint32_t>(nodes.size() / stride);
+        vector<Code> guesses(count);
+        vector<unsigned char> slotOf(level.size());
+        atomic<size_t> nextNode(0);
+        vector<thread> pool;
+
+        for (unsigned w = 0; w < workers; w++) {
+            pool.emplace_back([&, w]() {
+                CandidateStrategy& strategy =
+                    static_cast<CandidateStrategy&>(*strategies[w]);
+                for (size_t i = nextNode++; i < count; i = nextNode++) {
+                    const Code* list = level.data() + bounds[i];
+                    size_t size = bounds[i + 1] - bounds[i];
+                    guesses[i] = strategy.guessFor(list, size, length);
+                    for (size_t c = 0; c < size; c++) {
+                        slotOf[bounds[i] + c] = static_cast<unsigned char>(
+                            treeSlot(scoreCodes(list[c], guesses[i], length),
+                                     length));
+                    }
+                }
+            });
+        }
+        for (thread& worker : pool) {
+            worker.join();
+        }
+
+        // Stable counting sort of each node's candidates by hint slot
+        nodes.resize(nodes.size() + count * stride, 0);
+        vector<Code> nextLevel(level.size());
+        vector<size_t> nextBounds = {0};
+        uint32_t child = first + static_cast<uint32_t>(count);
+        size_t filled = 0;
+        vector<size_t> size(slots);
+        vector<size_t> offset(slots);
+
+        for (size_t i = 0; i < count; i++) {
+            uint32_t* node = &nodes[(first + i) * stride];
+            node[0] = guesses[i];
+            fill(size.begin(), size.end(), 0);
+            for (size_t c = bounds[i]; c < bounds[i + 1]; c++) {
+                size[slotOf[c]]++;
+            }
+            size[winSlot] = 0;      // Winning ends the game, no child
+            for (int s = 0; s < slots; s++) {
+                offset[s] = filled;
+                if (size[s] > 1) {
+                    node[1 + s] = child++;
+                    filled += size[s];
+                    nextBounds.push_back(filled);
+                }
+            }
+            for (size_t c = bounds[i]; c < bounds[i + 1]; c++) {
+                int s = slotOf[c];
+                if (size[s] == 1) {
+                    node[1 + s] = TREE_LEAF | level[c];
+                } else if (size[s] > 1) {
+                    nextLevel[offset[s]++] = level[c];
+                }
+            }
+        }
+
+        nextLevel.resize(filled);
+        level.swap(nextLevel);
+        bounds.swap(nextBounds);
+    }
+    return true;
+}
+
+/************************************************************
+* FUNCTION: writeTree
+*____________________________________________________________
+* PURPOSE:
+*    Saves a compiled tree: a TreeHeader, then the nodes as
+*    they sit in memory, ready to be mapped back in.
+*
+* PARAMETERS:
+*    - const string& path: File to create or overwrite.
+*    - const CodeSpace& space: The setting that was compiled.
+*    - const string& strategyName: The strategy compiled.
+*    - const vector<uint32_t>& nodes: From compileTree.
+*____________________________________________________________
+* RETURNS:
+*    bool: False if the file could not be written.
+************************************************************/
+bool writeTree(const string& path, const CodeSpace& space,
+               const string& strategyName, const vector<uint32_t>& nodes) {
+    TreeHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "MMDT", 4);
+    header.version = TREE_VERSION;
+    header.length = space.length();
+    header.duplicates = space.duplicates() ? 1 : 0;
+    header.slots = treeSlots(space.length());
+    header.nodeCount = static_cast<uint32_t>(nodes.size() / (1 + header.slots));
+    strncpy(header.strategy, strategyName.c_str(), sizeof(header.strategy) - 1);
+
+    ofstream file(path.c_str(), ios::binary | ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(nodes.data()),
+               nodes.size() * sizeof(uint32_t));
+    return static_cast<bool>(file);
+}
+
+/************************************************************
+* FUNCTION: DecisionTree::DecisionTree
+*____________________________________________________________
+* PURPOSE:
+*    Creates a closed tree; call open() to map a file.
+************************************************************/
+DecisionTree::DecisionTree() {
+    mapping = nullptr;
+    mappingSize = 0;
+    head = nullptr;
+    nodes = nullptr;
+    nodeStride = 0;
+}
+
+/************************************************************
+* FUNCTION: DecisionTree::~DecisionTree
+*____________________________________________________________
+* PURPOSE:
+*    Unmaps the file, if one is open.
+************************************************************/
+DecisionTree::~DecisionTree() {
+    close();
+}
+
+/************************************************************
+* FUNCTION: DecisionTree::open
+*____________________________________________________________
+* PURPOSE:
+*    Maps a tree file read-only and checks that its header
+*    describes a well-formed tree of exactly the file's size
+*    and that every node in it is well-formed.
+*
+* PARAMETERS:
+*    - const string& path: The file written by writeTree.
+*____________________________________________________________
+* RETURNS:
+*    bool: False if the file is missing or malformed; the
+*          tree is then left closed.
+************************************************************/
+bool DecisionTree::open(const string& path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 ||
+        info.st_size < static_cast<off_t>(sizeof(TreeHeader))) {
+        ::close(fd);
+        return false;
+    }
+    void* data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) return false;
+
+    mapping = data;
+    mappingSize = info.st_size;
+    head = static_cast<const TreeHeader*>(data);
+    nodeStride = 1 + head->slots;
+
+    bool valid = memcmp(head->magic, "MMDT", 4) == 0 &&
+                 head->version == TREE_VERSION &&
+                 (head->length == 4 || head->length == 6 ||
+                  head->length == 8) &&
+                 head->slots == static_cast<uint32_t>(treeSlots(head->length)) &&
+                 head->nodeCount > 0 &&
+                 mappingSize == sizeof(TreeHeader) +
+                     static_cast<size_t>(head->nodeCount) * nodeStride *
+                     sizeof(uint32_t);
+    if (valid) {
+        nodes = reinterpret_cast<const uint32_t*>(head + 1);
+        valid = checkNodes();
+    }
+    if (!valid) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+/************************************************************
+* FUNCTION: DecisionTree::checkNodes
+*____________________________________________________________
+* PURPOSE:
+*    Checks every word of a freshly mapped node array, so a
+*    damaged file cannot send a walk outside the mapping.
+*    Each guess and leaf must be a code of the setting, the
+*    winning slot must be empty, and every other child must
+*    point past its parent and inside the array, which is
+*    what the breadth-first layout guarantees and what keeps
+*    any walk from the root finite.
+*____________________________________________________________
+* RETURNS:
+*    bool: True if the tree can be walked safely.
+************************************************************/
+bool DecisionTree::checkNodes() const {
+    int length = head->length;
+    bool duplicates = head->duplicates != 0;
+    int winSlot = treeSlot(Hint{length, 0}, length);
+    if (head->duplicates > 1) return false;
+
+    for (uint32_t node = 0; node < head->nodeCount; node++) {
+        if (!validCode(guess(node), length, duplicates)) return false;
+        for (int s = 0; s < static_cast<int>(head->slots); s++) {
+            uint32_t word = child(node, s);
+            if (word == 0) continue;
+            if (s == winSlot) return false;
+            if (isLeaf(word)) {
+                if (!validCode(leafCode(word), length, duplicates)) return false;
+            } else if (word <= node || word >= head->nodeCount) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************
+* FUNCTION: DecisionTree::validCode
+*____________________________________________________________
+* PURPOSE:
+*    Checks that a word read from a file is a code that can
+*    be played in the tree's setting.
+*
+* PARAMETERS:
+*    - Code code: The word to check.
+*    - int length: The code length.
+*    - bool duplicates: Whether digits may repeat.
+*____________________________________________________________
+* RETURNS:
+*    bool: True if it fits in length digits, all distinct
+*          unless duplicates are allowed.
+************************************************************/
+bool DecisionTree::validCode(Code code, int length, bool duplicates) {
+    if (code >> (3 * length)) return false;
+    unsigned used = 0;
+    for (int i = 0; i < length; i++) {
+        unsigned digit = 1u << ((code >> (3 * i)) & 7);
+        if (!duplicates && (used & digit)) return false;
+        used |= digit;
+    }
+    return true;
+}
+
+/************************************************************
+* FUNCTION: DecisionTree::close
+*____________________________________________________________
+* PURPOSE:
+*    Unmaps the file, if one is open.
+************************************************************/
+void DecisionTree::close() {
+    if (mapping) munmap(mapping, mappingSize);
+    mapping = nullptr;
+    mappingSize = 0;
+    head = nullptr;
+    nodes = nullptr;
+    nodeStride = 0;
+}
+
+/************************************************************
+* FUNCTION: TreeStrategy::reset
+*____________________________________________________________
+* PURPOSE:
+*    Returns to the root, on the tree, for a new game.
+*
+* PARAMETERS:
+*    - const CodeSpace& space: The setting being played.
+*____________________________________________________________
+* RETURNS:
+*    bool: False if the tree was compiled for another
+*          setting or is not open.
+************************************************************/
+bool TreeStrategy::reset(const CodeSpace& space) {
+    position = 0;
+    onTree = true;
+    length = space.length();
+    return tree.isOpen() &&
+           tree.header().length == static_cast<uint32_t>(space.length()) &&
+           (tree.header().duplicates != 0) == space.duplicates();
+}
@@ -0,0 +1,138 @@
+/******************************************
+* Author    : Bryan Estrada               *
+* Teacher   : Dr. Mark Lehr               *
+* Class     : CSC-17C                     *
+* Assignment: Project #1                  *
+* Title     : Mastermind Decision Trees   *
+******************************************/
+
+#ifndef DECISIONTREE_H
+#define DECISIONTREE_H
+
+//Libraries
+#include "Strategy.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/************************************************************
+* STRUCT: TreeHeader
+*____________________________________________________________
+* PURPOSE:
+*    The first bytes of a compiled tree file. The node array
+*    follows immediately after it.
+*
+* MEMBERS:
+*    - char magic[4]: Always "MMDT".
+*    - uint32_t version: TREE_VERSION of the writer.
+*    - uint32_t length: Code length the tree plays.
+*    - uint32_t duplicates: 1 if digits may repeat, 0 if not.
+*    - uint32_t slots: Child slots per node (treeSlots()).
+*    - uint32_t nodeCount: Number of nodes.
+*    - char strategy[16]: Name of the strategy compiled.
+************************************************************/
+struct TreeHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t length;
+    uint32_t duplicates;
+    uint32_t slots;
+    uint32_t nodeCount;
+    char strategy[16];
+};
+
+//Global Constants
+const uint32_t TREE_VERSION = 2;
+const uint32_t TREE_LEAF = 0x80000000u;   // Child word holds a code
+
+//Function prototypes
+int treeSlots(int);
+int treeSlot(const Hint&, int);
+bool compileTree(const CodeSpace&, const std::string&,
+                 std::vector<uint32_t>&);
+bool writeTree(const std::string&, const CodeSpace&, const std::string&,
+               const std::vector<uint32_t>&);
+
+/************************************************************
+* CLASS: DecisionTree
+*____________________________________________________________
+* PURPOSE:
+*    A compiled strategy, memory-mapped read-only from its
+*    file. Nodes are laid out breadth-first with the root at
+*    index 0, each one (1 + slots) words long: the guess to
+*    play, then one child word per hint slot. A child of 0
+*    means that hint cannot happen there (or wins the game):
+*    the root is never anyone's child and open() rejects any
+*    child that does not point past its parent, so 0 is
+*    never a valid child index. A hint that
+*    leaves a single candidate needs no node: its word is
+*    TREE_LEAF plus that code, the only guess left to play.
+************************************************************/
+class DecisionTree {
+public:
+    DecisionTree();
+    ~DecisionTree();
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return nodes != nullptr; }
+    const TreeHeader& header() const { return *head; }
+    uint32_t stride() const { return nodeStride; }
+    Code guess(uint32_t node) const { return nodes[node * nodeStride]; }
+    uint32_t child(uint32_t node, int slot) const {
+        return nodes[node * nodeStride + 1 + slot];
+    }
+    static bool isLeaf(uint32_t word) { return (word & TREE_LEAF) != 0; }
+    static Code leafCode(uint32_t word) { return word & ~TREE_LEAF; }
+private:
+    DecisionTree(const DecisionTree&);            // Not copyable
+    DecisionTree& operator=(const DecisionTree&);
+    bool checkNodes() const;
+    static bool validCode(Code code, int length, bool duplicates);
+    void* mapping;
+    size_t mappingSize;
+    const TreeHeader* head;
+    const uint32_t* nodes;
+    uint32_t nodeStride;
+};
+
+/************************************************************
+* CLASS: TreeStrategy
+*____________________________________________________________
+* PURPOSE:
+*    Plays a compiled DecisionTree: each guess and each hint
+*    is a single indexed load, with no candidates to scan.
+*    The position is a node index or a leaf word. A hint
+*    with no child (a win, or one the tree rules out) keeps
+*    the position and marks the strategy off the tree, so a
+*    caller that keeps going cannot silently restart from
+*    the root. Several TreeStrategy objects may share one
+*    tree.
+************************************************************/
+class TreeStrategy : public Strategy {
+public:
+    explicit TreeStrategy(const DecisionTree& tree) : tree(tree) {}
+    const char* name() const { return "tree"; }
+    bool reset(const CodeSpace& space);
+    Code nextGuess() {
+        return DecisionTree::isLeaf(position) ? DecisionTree::leafCode(position)
+                                              : tree.guess(position);
+    }
+    void observe(Code, const Hint& hint) {
+        if (!onTree) return;
+        uint32_t next = DecisionTree::isLeaf(position)
+                            ? 0 : tree.child(position, treeSlot(hint, length));
+        if (next != 0) {
+            position = next;
+        } else {
+            onTree = false;
+        }
+    }
+    bool followingTree() const { return onTree; }
+private:
+    const DecisionTree& tree;
+    uint32_t position = 0;
+    bool onTree = true;
+    int length = 0;
+};
+
+#endif /* DECISIONTREE_H */
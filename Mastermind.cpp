@@ -0,0 +1,414 @@
+/******************************************
+* Author    : Bryan Estrada               *
+* Teacher   : Dr. Mark Lehr               *
+* Class     : CSC-17C                     *
+* Assignment: Project #1                  *
+* Title     : Mastermind Game Engine      *
+******************************************/
+
+//Libraries
+#include "Mastermind.h"
+#include <cstdlib>   // Random Function Library
+#include <cctype>
+#include <cstdint>
+#include <algorithm>
+#include <bitset>
+using namespace std;
+
+/************************************************************
+* FUNCTION: genCode
+*____________________________________________________________
+* PURPOSE:
+*    Generates a random secret with rand(), so seeding with
+*    srand() reproduces the same secrets.
+*
+* PARAMETERS:
+*    - int length: Desired length of the generated code.
+*    - char choice: 'y' if digits may repeat, 'n' if not.
+*____________________________________________________________
+* RETURNS:
+*    Code: The packed secret. Without duplicates the digits
+*          are a partial Fisher-Yates shuffle of 1 to 8.
+************************************************************/
+Code genCode(int length, char choice) {
+    int numbers[NUM_DIGITS] = {0, 1, 2, 3, 4, 5, 6, 7};
+    Code code = 0;
+
+    for (int i = 0; i < length; i++) {
+        int digit;
+        if (tolower(choice) == 'y') {
+            digit = rand() % NUM_DIGITS;
+        } else {
+            swap(numbers[i], numbers[i + rand() % (NUM_DIGITS - i)]);
+            digit = numbers[i];
+        }
+        code |= static_cast<Code>(digit) << (3 * i);
+    }
+    return code;
+}
+
+/************************************************************
+* FUNCTION: parseGuess
+*____________________________________________________________
+* PURPOSE:
+*    Validates a typed guess for format, length and digits
+*    (1-8) and packs it.
+*
+* PARAMETERS:
+*    - const char* input: The characters the player typed.
+*    - size_t size: Number of characters in input.
+*    - int length: The expected length of the guess.
+*    - Code& guess: Receives the packed guess when valid.
+*____________________________________________________________
+* RETURNS:
+*    GuessError: GUESS_OK, or the first problem found.
+************************************************************/
+GuessError parseGuess(const char* input, size_t size, int length,
+                      Code& guess) {
+    if (size == 0) return GUESS_EMPTY;
+    for (size_t i = 0; i < size; i++) {
+        if (!isdigit(static_cast<unsigned char>(input[i]))) {
+            return GUESS_NOT_DIGITS;
+        }
+    }
+    if (size != static_cast<size_t>(length)) return GUESS_WRONG_LENGTH;
+
+    guess = 0;
+    for (int i = 0; i < length; i++) {
+        if (input[i] < '1' || input[i] > '8') return GUESS_OUT_OF_RANGE;
+        guess |= static_cast<Code>(input[i] - '1') << (3 * i);
+    }
+    return GUESS_OK;
+}
+
+/************************************************************
+* FUNCTION: packCode
+*____________________________________________________________
+* PURPOSE:
+*    Packs a string of digits '1' to '8' into a Code.
+*
+* PARAMETERS:
+*    - const string& digits: The code as typed by the player.
+*____________________________________________________________
+* RETURNS:
+*    Code: The packed code.
+************************************************************/
+Code packCode(const string& digits) {
+    Code code = 0;
+    for (size_t i = 0; i < digits.size(); i++) {
+        code |= static_cast<Code>(digits[i] - '1') << (3 * i);
+    }
+    return code;
+}
+
+/************************************************************
+* FUNCTION: codeToString
+*____________________________________________________________
+* PURPOSE:
+*    Unpacks a Code back into its digits '1' to '8'.
+*
+* PARAMETERS:
+*    - Code code: The packed code.
+*    - int length: Number of digits in the code.
+*____________________________________________________________
+* RETURNS:
+*    string: The code as the player would type it.
+************************************************************/
+string codeToString(Code code, int length) {
+    string digits(length, '1');
+    for (int i = 0; i < length; i++) {
+        digits[i] = static_cast<char>('1' + ((code >> (3 * i)) & 7));
+    }
+    return digits;
+}
+
+/************************************************************
+* FUNCTION: scoreCodes
+*____________________________________________________________
+* PURPOSE:
+*    Computes the hint a guess earns against a secret, the
+*    same O/X counts the console prints.
+*
+* PARAMETERS:
+*    - Code secret: The code being guessed.
+*    - Code guess: The guess to score.
+*    - int length: Number of digits in both codes.
+*____________________________________________________________
+* RETURNS:
+*    Hint: Correct and misplaced digit counts.
+************************************************************/
+Hint scoreCodes(Code secret, Code guess, int length) {
+    int secretCount[NUM_DIGITS] = {0};
+    int guessCount[NUM_DIGITS] = {0};
+    Hint result = {0, 0};
+
+    for (int i = 0; i < length; i++) {
+        int s = (secret >> (3 * i)) & 7;
+        int g = (guess >> (3 * i)) & 7;
+        if (s == g) {
+            result.correct++;
+        } else {
+            secretCount[s]++;   // Unmatched digits may still be misplaced
+            guessCount[g]++;
+        }
+    }
+    for (int d = 0; d < NUM_DIGITS; d++) {
+        result.misplaced += min(secretCount[d], guessCount[d]);
+    }
+    return result;
+}
+
+/************************************************************
+* FUNCTION: hintIndex
+*____________________________________________________________
+* PURPOSE:
+*    Maps a hint to a slot in [0, HINT_SLOTS) so hint groups
+*    can be counted in a flat array.
+*
+* PARAMETERS:
+*    - const Hint& hint: The hint to map.
+*____________________________________________________________
+* RETURNS:
+*    int: The hint's slot.
+************************************************************/
+int hintIndex(const Hint& hint) {
+    return hint.correct * (MAX_CODE_LENGTH + 1) + hint.misplaced;
+}
+
+/************************************************************
+* FUNCTION: permutationCount
+*____________________________________________________________
+* PURPOSE:
+*    Counts the secrets without duplicates: 8P4 = 1680, 
+*    8P6 = 20160 and 8P8 = 40320.
+*
+* PARAMETERS:
+*    - int length: The code length.
+*____________________________________________________________
+* RETURNS:
+*    unsigned: 8! / (8 - length)!
+************************************************************/
+unsigned permutationCount(int length) {
+    unsigned count = 1;
+    for (int i = 0; i < length; i++) {
+        count *= NUM_DIGITS - i;
+    }
+    return count;
+}
+
+/************************************************************
+* FUNCTION: rankPermutation
+*____________________________________________________________
+* PURPOSE:
+*    Numbers a code with distinct digits by its Lehmer code:
+*    for each position, from the highest down, how many
+*    still unused digits are smaller, read as a mixed-radix
+*    number (radix 8, 7, 6, ...). Ranks follow the codes'
+*    ascending order and fill [0, permutationCount(length))
+*    with no gaps.
+*
+* PARAMETERS:
+*    - Code code: A code with no repeated digits.
+*    - int length: Number of digits in the code.
+*____________________________________________________________
+* RETURNS:
+*    unsigned: The code's rank.
+************************************************************/
+unsigned rankPermutation(Code code, int length) {
+    unsigned rank = 0;
+    unsigned used = 0;     // Bit d set once digit d is placed
+    for (int i = length - 1; i >= 0; i--) {
+        unsigned digit = (code >> (3 * i)) & 7;
+        unsigned smaller = bitset<NUM_DIGITS>(~used & ((1u << digit) - 1)).count();
+        rank = rank * (NUM_DIGITS - (length - 1 - i)) + smaller;
+        used |= 1u << digit;
+    }
+    return rank;
+}
+
+/************************************************************
+* FUNCTION: unrankPermutation
+*____________________________________________________________
+* PURPOSE:
+*    Inverse of rankPermutation: splits the rank back into
+*    its mixed-radix digits and places, for each position,
+*    the unused digit with that many smaller unused digits.
+*
+* PARAMETERS:
+*    - unsigned rank: A rank below permutationCount(length).
+*    - int length: Number of digits in the code.
+*____________________________________________________________
+* RETURNS:
+*    Code: The code with that rank.
+************************************************************/
+Code unrankPermutation(unsigned rank, int length) {
+    unsigned lehmer[MAX_CODE_LENGTH];
+    for (int i = 0; i < length; i++) {
+        unsigned radix = NUM_DIGITS - (length - 1 - i);
+        lehmer[i] = rank % radix;
+        rank /= radix;
+    }
+
+    Code code = 0;
+    unsigned used = 0;
+    for (int i = length - 1; i >= 0; i--) {
+        unsigned digit = 0;
+        for (unsigned skip = lehmer[i]; ; digit++) {
+            if (used & (1u << digit)) continue;
+            if (skip == 0) break;
+            skip--;
+        }
+        used |= 1u << digit;
+        code |= static_cast<Code>(digit) << (3 * i);
+    }
+    return code;
+}
+
+/************************************************************
+* FUNCTION: Arena::Arena
+*____________________________________________________________
+* PURPOSE:
+*    Wraps a caller-owned buffer. The arena never frees it.
+*
+* PARAMETERS:
+*    - void* buffer: Start of the memory to hand out.
+*    - size_t capacity: Size of the buffer in bytes.
+************************************************************/
+Arena::Arena(void* buffer, size_t capacity) {
+    base = static_cast<unsigned char*>(buffer);
+    this->capacity = capacity;
+    used = 0;
+}
+
+/************************************************************
+* FUNCTION: Arena::allocate
+*____________________________________________________________
+* PURPOSE:
+*    Carves the next aligned block out of the buffer.
+*
+* PARAMETERS:
+*    - size_t bytes: Size of the block.
+*    - size_t alignment: Required alignment, a power of two.
+*____________________________________________________________
+* RETURNS:
+*    void*: The block, or nullptr if the buffer is too full.
+************************************************************/
+void* Arena::allocate(size_t bytes, size_t alignment) {
+    uintptr_t start = reinterpret_cast<uintptr_t>(base) + used;
+    size_t padding = (alignment - start % alignment) % alignment;
+    if (padding + bytes > capacity - used) return nullptr;
+    used += padding + bytes;
+    return base + (used - bytes);
+}
+
+/************************************************************
+* FUNCTION: Game::Game
+*____________________________________________________________
+* PURPOSE:
+*    Creates an empty game; call start() before playing.
+************************************************************/
+Game::Game() {
+    codeLength = 0;
+    duplicateSetting = 'n';
+    secretCode = 0;
+    status = GAME_LOST;
+    turnCount = 0;
+}
+
+/************************************************************
+* FUNCTION: Game::start
+*____________________________________________________________
+* PURPOSE:
+*    Begins a new game, forgetting the previous history.
+*
+* PARAMETERS:
+*    - int length: Length of the code (4, 6 or 8).
+*    - char duplicates: 'y' if digits may repeat, 'n' if not.
+*    - Code secret: The code to be guessed, from genCode.
+************************************************************/
+void Game::start(int length, char duplicates, Code secret) {
+    codeLength = length;
+    duplicateSetting = static_cast<char>(tolower(duplicates));
+    secretCode = secret;
+    status = GAME_IN_PROGRESS;
+    turnCount = 0;
+}
+
+/************************************************************
+* FUNCTION: Game::play
+*____________________________________________________________
+* PURPOSE:
+*    Scores a guess, appends it to the history and uses up a
+*    turn. A guess matching the secret wins; running out of
+*    turns loses. Guesses after the game ended are ignored.
+*
+* PARAMETERS:
+*    - Code guess: A guess accepted by parseGuess.
+*____________________________________________________________
+* RETURNS:
+*    GameState: The state after this guess.
+************************************************************/
+GameState Game::play(Code guess) {
+    if (status != GAME_IN_PROGRESS) return status;
+
+    Turn& entry = history[turnCount++];
+    entry.guess = guess;
+    entry.hint = scoreCodes(secretCode, guess, codeLength);
+
+    if (entry.hint.correct == codeLength) {
+        status = GAME_WON;
+    } else if (turnCount == MAX_TURNS) {
+        status = GAME_LOST;
+    }
+    return status;
+}
+
+/************************************************************
+* FUNCTION: Statistics::Statistics
+*____________________________________________________________
+* PURPOSE:
+*    Starts every win and loss counter at zero.
+************************************************************/
+Statistics::Statistics() {
+    fill(&winCount[0][0], &winCount[0][0] + 6, 0);
+    fill(&lossCount[0][0], &lossCount[0][0] + 6, 0);
+}
+
+/************************************************************
+* FUNCTION: Statistics::record
+*____________________________________________________________
+* PURPOSE:
+*    Counts a finished game as a win or loss for its length
+*    and duplicate setting. Games still in progress are not
+*    counted.
+*
+* PARAMETERS:
+*    - const Game& game: The finished game.
+************************************************************/
+void Statistics::record(const Game& game) {
+    if (game.state() == GAME_IN_PROGRESS) return;
+    int lenIndex = (game.length() - 4) / 2;
+    int dupIndex = (game.duplicates() == 'y') ? 1 : 0;
+    if (game.state() == GAME_WON) winCount[lenIndex][dupIndex]++;
+    else lossCount[lenIndex][dupIndex]++;
+}
+
+/************************************************************
+* FUNCTION: Statistics::wins
+*____________________________________________________________
+* RETURNS:
+*    int: Games won at this length and duplicate setting.
+************************************************************/
+int Statistics::wins(int length, char duplicates) const {
+    return winCount[(length - 4) / 2][tolower(duplicates) == 'y' ? 1 : 0];
+}
+
+/************************************************************
+* FUNCTION: Statistics::losses
+*____________________________________________________________
+* RETURNS:
+*    int: Games lost at this length and duplicate setting.
+************************************************************/
+int Statistics::losses(int length, char duplicates) const {
+    return lossCount[(length - 4) / 2][tolower(duplicates) == 'y' ? 1 : 0];
+}
@@ -0,0 +1,177 @@
+/******************************************
+* Author    : Bryan Estrada               *
+* Teacher   : Dr. Mark Lehr               *
+* Class     : CSC-17C                     *
+* Assignment: Project #1                  *
+* Title     : Mastermind Game Engine      *
+******************************************/
+
+#ifndef MASTERMIND_H
+#define MASTERMIND_H
+
+//Libraries
+#include <cstddef>
+#include <string>
+
+//Global Constants
+const int MAX_CODE_LENGTH = 8;      // Longest code the game offers
+const int NUM_DIGITS = 8;           // Digits '1' to '8'
+const int MAX_TURNS = 10;           // Turns the player gets per game
+const int HINT_SLOTS = (MAX_CODE_LENGTH + 1) * (MAX_CODE_LENGTH + 1);
+
+//Types
+/************************************************************
+* TYPE: Code
+*____________________________________________________________
+* PURPOSE:
+*    A code packed 3 bits per digit, position 0 in the lowest
+*    bits. Each field holds the digit minus '1' (0 to 7), so
+*    the packed value doubles as the code's base-8 index.
+************************************************************/
+typedef unsigned int Code;
+
+/************************************************************
+* STRUCT: Hint
+*____________________________________________________________
+* PURPOSE:
+*    Feedback for one guess: the O's and X's of the console
+*    hint string.
+*
+* MEMBERS:
+*    - int correct: Digits in the right position (O's).
+*    - int misplaced: Digits in the wrong position (X's).
+************************************************************/
+struct Hint {
+    int correct;
+    int misplaced;
+};
+
+/************************************************************
+* STRUCT: Turn
+*____________________________________________________________
+* PURPOSE:
+*    One entry of a game's history.
+*
+* MEMBERS:
+*    - Code guess: The guess that was played.
+*    - Hint hint: The hint it earned.
+************************************************************/
+struct Turn {
+    Code guess;
+    Hint hint;
+};
+
+/************************************************************
+* ENUM: GuessError
+*____________________________________________________________
+* PURPOSE:
+*    Why parseGuess rejected an input, GUESS_OK if it did not.
+************************************************************/
+enum GuessError {
+    GUESS_OK,
+    GUESS_EMPTY,
+    GUESS_NOT_DIGITS,
+    GUESS_WRONG_LENGTH,
+    GUESS_OUT_OF_RANGE
+};
+
+/************************************************************
+* ENUM: GameState
+*____________________________________________________________
+* PURPOSE:
+*    Whether a game is still being played, won or lost.
+************************************************************/
+enum GameState {
+    GAME_IN_PROGRESS,
+    GAME_WON,
+    GAME_LOST
+};
+
+//Function prototypes
+Code genCode(int, char);
+GuessError parseGuess(const char*, size_t, int, Code&);
+Code packCode(const std::string&);
+std::string codeToString(Code, int);
+Hint scoreCodes(Code, Code, int);
+int hintIndex(const Hint&);
+unsigned permutationCount(int);
+unsigned rankPermutation(Code, int);
+Code unrankPermutation(unsigned, int);
+
+/************************************************************
+* CLASS: Arena
+*____________________________________________________________
+* PURPOSE:
+*    Hands out memory from a buffer the caller owns. Nothing
+*    is freed one piece at a time; reset() releases it all.
+*    Engine code takes its working memory from an Arena so
+*    the caller decides where it lives and no turn touches
+*    the heap.
+************************************************************/
+class Arena {
+public:
+    Arena(void* buffer, size_t capacity);
+    void* allocate(size_t bytes, size_t alignment);
+    template <typename T>
+    T* allocateArray(size_t count) {
+        return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+    }
+    void reset() { used = 0; }
+    size_t bytesUsed() const { return used; }
+    size_t bytesFree() const { return capacity - used; }
+private:
+    unsigned char* base;
+    size_t capacity;
+    size_t used;
+};
+
+/************************************************************
+* CLASS: Game
+*____________________________________________________________
+* PURPOSE:
+*    The rules of one game: the secret, the turns left and
+*    the history of guesses and hints. History lives in a
+*    fixed array inside the object, so playing a turn never
+*    allocates.
+************************************************************/
+class Game {
+public:
+    Game();
+    void start(int length, char duplicates, Code secret);
+    GameState play(Code guess);
+    GameState state() const { return status; }
+    int length() const { return codeLength; }
+    char duplicates() const { return duplicateSetting; }
+    Code secret() const { return secretCode; }
+    int turnsUsed() const { return turnCount; }
+    int turnsLeft() const { return MAX_TURNS - turnCount; }
+    const Turn& turn(int index) const { return history[index]; }
+    const Turn& lastTurn() const { return history[turnCount - 1]; }
+private:
+    int codeLength;
+    char duplicateSetting;
+    Code secretCode;
+    GameState status;
+    int turnCount;
+    Turn history[MAX_TURNS];
+};
+
+/************************************************************
+* CLASS: Statistics
+*____________________________________________________________
+* PURPOSE:
+*    Wins and losses per code length (4, 6, 8) and duplicate
+*    setting, over every finished game.
+************************************************************/
+class Statistics {
+public:
+    Statistics();
+    void record(const Game& game);
+    int wins(int length, char duplicates) const;
+    int losses(int length, char duplicates) const;
+private:
+    int winCount[3][2];
+    int lossCount[3][2];
+};
+
+#endif /* MASTERMIND_H */
@@ -11,135 +11,131 @@
 #include <cstdlib>   // Random Function Library
 #include <ctime>     // Time Library
 #include <string>
-#include <set>
-#include <list>
-#include <stack>
-#include <queue>
-#include <map>
-#include <utility>
+#include <vector>
+#include <stdexcept>
 #include <algorithm>
+#include <iomanip>
+#include "Mastermind.h"
+#include "Strategy.h"
+#include "DecisionTree.h"
+#include "Warmup.h"
 using namespace std;
 
-//Structures
-/************************************************************
-* STRUCT: GameResult
-*____________________________________________________________
-* PURPOSE:
-*    Holds the result of a single game of Mastermind, 
-*    including game settings and outcome.
-*
-* MEMBERS:
-*    - int codeLength: Length of the code used in the game.
-*    - char duplicateSetting: Character indicating whether 
-*                             duplicates are allowed ('Y' for
-*                             yes, 'N' for no).
-*    - isWin (bool): True if the player won the game, false 
-*                    if lost.
-*
-* CONSTRUCTOR:
-*    GameResult(int len, char dup, bool win):
-*       Initializes a GameResult with given code length, 
-*       duplicate setting, and win/loss outcome.
-************************************************************/
-struct GameResult {
-    int codeLength;
-    char duplicateSetting;
-    bool isWin; // true if user won, false if lost
-    GameResult(int len, char dup, bool win)  {
-        codeLength = len; 
-        duplicateSetting = dup; 
-        isWin = win;
-    }
-};
-
 //Function prototypes
 void setupGame();
 char getDuplicateChoice();
 int getCodeLength();
-void genCode(int, list<char>&, char);
-void printCode(const list<char>&);
-void hint(const list<char>&, const list<char>&);
-void showGameOverMessage(const list<char>&);
+void printCode(Code, int);
+void printHint(const Hint&, int);
+void showGameOverMessage(const Game&);
 void showInstructions();
-void validInput(const string&, bool&, const int&);
-void compareGuess(list<char>&, const string&, const list<char>&, bool&, 
-                  stack<int>&, const int&, const char&, queue<GameResult>&);
+void showSuggestion(const Game&, Warmup&, Advisor&, bool&);
+void validInput(const string&, bool&, const int&, Code&);
+void compareGuess(Game&, Code, bool&, Statistics&, Advisor&, bool);
 void exitingGame(bool&);
 void newGame(char&);
-void recordResult(int, char, bool, queue<GameResult>&);
-void displayStatistics(queue<GameResult>&);
+void displayStatistics(const Statistics&);
 void printWelcome();
 void printGameOver();
+int runTournamentMode(int, char*[]);
+int runCompileTreeMode(int, char*[]);
+void displayTournament(const vector<TournamentResult>&, int, char, int);
 
 /************************************************************
 * FUNCTION: main
 *____________________________________________________________
 * PURPOSE:
-*    The entry point for the Mastermind game. Initializes 
-*    game components, sets up the gameplay loop, processes 
-*    player input, and manages game flow, including player 
-*    statistics and exit conditions.
+*    The entry point for the Mastermind game. A thin console
+*    client over the engine in Mastermind.h: it prompts for
+*    settings, reads guesses and prints what the Game object
+*    reports, including player statistics and exit
+*    conditions.
 *
 * LOCAL VARIABLES:
-*    - queue<GameResult> resultsQueue: Holds results of each 
-*                                      completed game for 
- *                                     later display.
+*    - Statistics stats: Wins and losses of every completed 
+*                        game played without 'suggest', for
+*                        later display.
+*    - Game game: The rules, secret code, turns and history
+*                 of the current game.
 *    - char playAgain: Indicates if the player wants to play 
 *                      another game ('y' or 'n').
-*    - list<char> code: Stores the randomly generated game 
-*                       code.
-*    - list<char> guess: Stores the player's current guess.
+*    - Code guess: The player's current guess, once valid.
 *    - char choiceDuplicate: Tracks whether duplicates are 
 *                            allowed in the code.
 *    - int length: Represents the length of the code.
-*    - stack<int> turns: Holds the number of turns (max 10) 
-*                        for each game.
 *    - string guess_input: Stores player's input for each 
 *                          guess.
 *    - bool quit: Flag to control game exit.
 *    - bool endGame: Indicates if the current game is 
  *                   complete.
 *    - bool skipTurn: Skips the turn loop if necessary.
+*    - bool assisted: Set once the solver has suggested a
+*                     guess in the current game.
+*    - Warmup warmup: Prepares the solver for 'suggest' in
+*                     the background while the player reads
+*                     the title and answers the prompts.
+*    - Advisor advisor: Follows each game to answer 'suggest'
+*                       without redoing earlier turns.
+*
+* COMMAND LINE:
+*    --tournament [length] [y|n] [games] [seed] [tree file]
+*       Skips the console game and pits the solver strategies
+*       against each other instead (see runTournamentMode).
+*    --compile-tree <strategy> <length> <y|n> <tree file>
+*       Compiles a strategy into a decision tree file (see 
+*       runCompileTreeMode).
 ************************************************************/ 
-int main() 
+int main(int argc, char* argv[]) 
 {
-    queue<GameResult> resultsQueue;
+    if (argc > 1 && string(argv[1]) == "--tournament") {
+        return runTournamentMode(argc, argv);
+    }
+    if (argc > 1 && string(argv[1]) == "--compile-tree") {
+        return runCompileTreeMode(argc, argv);
+    }
+
+    Statistics stats;
+    Game game;
     char playAgain = 'y';    
-    list<char> code;
-    list<char> guess;
+    Code guess = 0;
     char choiceDuplicate;
     int length;
-    stack<int> turns;
     string guess_input;
     bool quit = false;  // Flag to control exit
+    Warmup warmup;
+    Advisor advisor;
     
+    warmup.start(".");  // Overlap solver setup with the prompts below
     setupGame();    //Setting up the random function
     printWelcome();
     
     do {
         bool endGame = false;
         bool skipTurn = false; // Flag to skip the turn without using `continue`
+        bool assisted = false; // The solver helped, so the game is not scored
         playAgain = tolower(playAgain);
         
         if(playAgain == 'y') {
-            for (int i = 1; i <= 10; i++) turns.push(i);
-            
             // Get valid code length
             length = getCodeLength();
+            warmup.select(length, '\0');   // Stop warming other lengths
 
             // Get valid choice for duplicates
             choiceDuplicate = getDuplicateChoice();
+            warmup.select(length, choiceDuplicate);
 
-            genCode(length, code, choiceDuplicate);
+            game.start(length, choiceDuplicate, genCode(length, choiceDuplicate));
+            advisor.newGame(game);
             //cout << "\t\tCODE: ";
-            //printCode(code);
+            //printCode(game.secret(), length);
             cout << "\nWrite a code using the numbers from 1 to 8. You have 10 "
                     "turns to guess the code.\n";
 
-            while (!endGame && !turns.empty() && !quit) {    
+            while (!endGame && !quit) {    
                 skipTurn = false; // Reset skipTurn flag at the start of each turn
                 cout << "Type 'exit' anytime to quit the game." << endl;
                 cout << "Type 'tutorial' to see game's instructions." << endl;
+                cout << "Type 'suggest' to get a guess from the solver." << endl;
                 cout << "\nGuess: ";
                 cin >> guess_input;
 
@@ -154,151 +150,71 @@ int main()
                     skipTurn = true;
                 }
 
+                if (guess_input == "suggest") {
+                    showSuggestion(game, warmup, advisor, assisted);
+                    skipTurn = true;
+                }
+
                 // First try-catch block: Check guess input
                 if(!skipTurn){
-                    validInput(guess_input, skipTurn, length);
+                    validInput(guess_input, skipTurn, length, guess);
                 }
 
-                // Clear the previous guess and add the new one from input
+                // Play the validated guess
                 if(!skipTurn){
-                    compareGuess(guess, guess_input, code, endGame, turns, 
-                                 length, choiceDuplicate, resultsQueue);
+                    compareGuess(game, guess, endGame, stats, advisor, assisted);
                 }
             }
 
             if (!quit) {
-                showGameOverMessage(code);
-                displayStatistics(resultsQueue);  // Show statistics after each game
+                showGameOverMessage(game);
+                displayStatistics(stats);  // Show statistics after each game
                 newGame(playAgain);
             }
         }
-        code.clear();
     } while (playAgain == 'y' && !quit);
 
     return 0;
 }
 
-/************************************************************
-* FUNCTION: genCode
-*____________________________________________________________
-* PURPOSE:
-*    Generates a random code for the Mastermind game based on
-*    the specified length and duplicate setting.
-*
-* PARAMETERS:
-*    - int length: Desired length of the generated code.
-*    - list<char>& code: Reference to a list where the 
-*      generated code will be stored.
-*    - char choice: Character that indicates if duplicates 
-*      are allowed ('Y' for yes, 'N' for no).
-*
-* LOCAL VARIABLES:
-*    - set<char> unique_numbers: Used to store unique 
-*      characters for codes with no duplicates.
-*    - deque<char> numbers: Contains possible characters 
-*      ('1' to '8') for code generation.
-*    - auto num_int: Iterator pointing to the start of 
-*      the numbers deque.
-*____________________________________________________________ 
-* RETURN: 
-*    Void: Modifies the 'code' list to hold the newly
-*    generated random sequence of characters based on 
-*    the specified length and duplicate settings.   
-************************************************************/ 
-void genCode(int length, list<char>& code, char choice) {
-    set<char> unique_numbers;
-    deque<char> numbers = {'1', '2', '3', '4', '5', '6', '7', '8'};
-    
-    auto num_int = numbers.begin();
-    
-    while (code.size() < length) {
-        random_shuffle(numbers.begin(), numbers.end());
-        //char num = '1' + rand() % 8;
-        if (toupper(choice) == 'Y' || unique_numbers.find(*num_int) == 
-            unique_numbers.end()) {
-            code.push_back(*num_int);
-            unique_numbers.insert(*num_int);
-            num_int++;
-        }
-    }
-}
-
 /************************************************************
 * FUNCTION: printCode
 *____________________________________________________________
 * PURPOSE:
-*    Displays the generated code sequence by printing each 
-*    character in the code list.
+*    Displays a code sequence by printing each of its digits.
 *
 * PARAMETERS:
-*    - const list<char>& code: Reference to a list containing 
-*      the code characters to be printed.
+*    - Code code: The packed code to be printed.
+*    - int length: Number of digits in the code.
 *____________________________________________________________
 * RETURNS:
 *    Void: Outputs the code sequence to the console.  
 ************************************************************/ 
-void printCode(const list<char>& code) {
-    for (char num : code) {
-        cout << num;
-    }
-    cout << endl;
+void printCode(Code code, int length) {
+    cout << codeToString(code, length) << endl;
 }
 
 /************************************************************
-* FUNCTION: hint
+* FUNCTION: printHint
 *____________________________________________________________
 * PURPOSE:
-*    Generates a hint to guide the player by indicating 
-*    the number of correct and misplaced digits in the guess.
+*    Shows the hint the engine computed for a guess, guiding
+*    the player by the number of correct and misplaced 
+*    digits.
 *
 * PARAMETERS:
-*    - const list<char>& code: The actual code sequence the 
-*      player is attempting to guess.
-*    - const list<char>& guess: The player's current guess of
-*      the code.
+*    - const Hint& hint: Correct and misplaced digit counts.
+*    - int length: The length of the code.
 *____________________________________________________________
 * RETURNS:
 *    Void: Outputs the hint string to the console, guiding 
 *          the player in future guesses.
 ************************************************************/
-void hint(const list<char>& code, const list<char>& guess) {
-    map<char, int> code_count;
-    int correct = 0;     // Counts correct positions (O's)
-    int misplaced = 0;   // Counts misplaced digits (X's)
-    
-    // First pass: Check for correct positions and track remaining code digits
-    auto code_it = code.begin();
-    auto guess_it = guess.begin();
-    while (code_it != code.end()) {
-        if (*code_it == *guess_it) {
-            correct++;  // Increment correct count for each matching position
-        } else {
-            code_count[*code_it]++;  // Track unmatched code digits for misplaced checking
-        }
-        ++code_it;
-        ++guess_it;
-    }
-
-    // Second pass: Check for misplaced digits (wrong position but correct digit)
-    guess_it = guess.begin();
-    code_it = code.begin();
-    while (guess_it != guess.end()) {
-        auto found = find(code.begin(), code.end(), *guess_it); // Search for the guess in the rest of the code
-        // Use find to check if *guess_it is in the remaining code characters
-        if (*code_it != *guess_it && code_count[*found] > 0) {
-                misplaced++;               // Increment misplaced count if digit is in the wrong position
-                code_count[*found]--;   // Decrement count to avoid double-counting
-            }
-        ++guess_it;
-        ++code_it;
-    }
-    
-    // Create the hint result string
-    string hint_result(correct, 'O');   // Add all 'O's for correct positions
-    hint_result += string(misplaced, 'X'); // Add all 'X's for misplaced digits
-    hint_result += string(code.size() - correct - misplaced, '_'); // Add all '_'s for incorrect digits
+void printHint(const Hint& hint, int length) {
+    string hint_result(hint.correct, 'O');   // Add all 'O's for correct positions
+    hint_result += string(hint.misplaced, 'X'); // Add all 'X's for misplaced digits
+    hint_result += string(length - hint.correct - hint.misplaced, '_'); // Add all '_'s for incorrect digits
 
-    // Print hint result
     cout << "Hint: " << hint_result << endl;
 }
 
@@ -400,16 +316,16 @@ char getDuplicateChoice(){
 *    code, and displays a game over message.
 *
 * PARAMETERS:
-*    - const list<char> &code: The actual code used in the 
-*                              game, which is revealed to the 
-*                              player upon game over.
+*    - const Game &game: The finished game, whose secret code
+*                        is revealed to the player upon game
+*                        over.
 *____________________________________________________________
 * RETURNS:
 *    Void: Outputs the code and game-over message.
 ************************************************************/
-void showGameOverMessage(const list<char> &code){
+void showGameOverMessage(const Game &game){
     cout << "\nThe code was: ";
-    printCode(code);
+    printCode(game.secret(), game.length());
     printGameOver(); 
 }
 
@@ -442,7 +358,8 @@ void newGame(char &playAgain){
 * PURPOSE:
 *    Displays the instructions for the Mastermind game, 
 *    explaining the rules, the goal of the game, how guesses 
-*    and hints work, and how to enter valid inputs.
+*    and hints work, how to enter valid inputs, and what the
+*    'suggest' command does to the statistics.
 *____________________________________________________________
 * RETURNS:
 *    Void: Outputs the game's instructions to the console.
@@ -475,6 +392,11 @@ void showInstructions(){
             "\n*\tincorrect digits. As you can notice, the hint does not show you "
             "\n*\twhat digit's place was right, wrong or incorrect, it only shows "
             "\n*\tthe amount." << endl << "*" << endl;
+    cout << "*\tStuck? Type 'suggest' instead of a guess and the solver will "
+            "\n*\tpropose one, once it has finished warming up. The suggestion "
+            "\n*\tdoes not use up a turn, but a game in which you asked for one "
+            "\n*\tis not counted in your win and loss statistics."
+         << endl << "*" << endl;
     cout << "*\t\t\tHAPPY GUESSING! :D" << endl;
     
     for(int i = 0 ; i < 80; i++){
@@ -483,12 +405,47 @@ void showInstructions(){
     cout << endl;
 }
 
+/************************************************************
+* FUNCTION: showSuggestion
+*____________________________________________________________
+* PURPOSE:
+*    Shows the solver's next guess for the current game, if
+*    the warmup has the solver for this setting ready. It
+*    never waits for the warmup.
+*
+* PARAMETERS:
+*    - const Game& game: The game in progress.
+*    - Warmup& warmup: The background solver preparation.
+*    - Advisor& advisor: Follows the game between calls.
+*    - bool& assisted: Set when a guess is suggested.
+*____________________________________________________________
+* RETURNS:
+*    Void: Outputs the suggested guess to the console.
+************************************************************/
+void showSuggestion(const Game& game, Warmup& warmup, Advisor& advisor,
+                    bool& assisted){
+    const SolverState* solver = warmup.tryTake(game.length(), 
+                                               game.duplicates());
+    if (!solver) {
+        cout << "The solver is still warming up. Try again in a moment." 
+             << endl;
+        return;
+    }
+
+    Code guess;
+    if (advisor.suggest(*solver, game, guess)) {
+        cout << "Suggested guess: " << codeToString(guess, game.length()) << endl;
+        assisted = true;
+    }
+}
+
 /************************************************************
 * FUNCTION: validInput
 *____________________________________________________________
 * PURPOSE:
 *    Validates the player's guess input for correctness 
-*    in terms of format, length, and valid characters (1-8).
+*    in terms of format, length, and valid characters (1-8),
+*    turning the engine's parseGuess result into a message.
 *
 * PARAMETERS:
 *    - const string& guess_input: The player's guess input to 
@@ -497,25 +454,27 @@ void showInstructions(){
 *                      the current turn if the input is 
 *                      invalid.
 *    - const int& length: The expected length of the guess.
+*    - Code& guess: Receives the packed guess when valid.
 *____________________________________________________________
 * RETURNS:
 *    Void: Outputs an error message and skips the turn if the 
 *          input is invalid.
 ************************************************************/
-void validInput(const string &guess_input, bool &skipTurn, const int &length){
+void validInput(const string &guess_input, bool &skipTurn, const int &length,
+                Code &guess){
     try {
-        if (guess_input.empty()){ 
-            throw invalid_argument("Input cannot be empty. Please try again.");
-        }
-        if (!all_of(guess_input.begin(), guess_input.end(), ::isdigit)){ 
-            throw invalid_argument("Guess contains invalid characters. Use only numbers.");
-        }
-        if (guess_input.size() != length){ 
-            throw invalid_argument("Guess length does not match the code length.");
-        }
-        for (char ch : guess_input) {
-            if (ch < '1' || ch > '8') 
+        switch (parseGuess(guess_input.data(), guess_input.size(), length, 
+                           guess)) {
+            case GUESS_EMPTY: 
+                throw invalid_argument("Input cannot be empty. Please try again.");
+            case GUESS_NOT_DIGITS: 
+                throw invalid_argument("Guess contains invalid characters. Use only numbers.");
+            case GUESS_WRONG_LENGTH: 
+                throw invalid_argument("Guess length does not match the code length.");
+            case GUESS_OUT_OF_RANGE: 
                 throw invalid_argument("Guess contains invalid numbers. Only use 1 to 8.");
+            case GUESS_OK: 
+                break;
         }
     } catch (const invalid_argument& e) {
         cout << "Error: " << e.what() << endl;
@@ -527,59 +486,46 @@ void validInput(const string &guess_input, bool &skipTurn, const int &length){
 * FUNCTION: compareGuess
 *____________________________________________________________
 * PURPOSE:
-*    Compares the player's guess to the generated code, 
+*    Plays the player's guess against the generated code, 
 *    provides feedback through hints, and determines if the 
 *    game is won or lost.
 *
 * PARAMETERS:
-*    - list<char>& guess: The list storing the player's 
-*                         current guess.
-*    - const string& guess_input: The string containing the 
-*                                 player's guess.
-*    - const list<char>& code: The list storing the generated 
-*                              code.
+*    - Game& game: The game being played.
+*    - Code guess: The player's validated guess.
 *    - bool& endGame: A flag that indicates if the game has 
 *                     ended.
-*    - stack<int>& turns: A stack holding the remaining 
-*                         turns.
-*    - const int& length: The length of the code/guess.
-*    - const char& choiceDuplicate: A character indicating 
-*                                   whether duplicates are 
-*                                   allowed.
-*    - queue<GameResult>& resultsQueue: A queue to store game 
-*                                       results.
+*    - Statistics& stats: Where finished games are recorded.
+*    - Advisor& advisor: Narrowed by the new hint, if it is
+*                        following the game.
+*    - bool assisted: True if 'suggest' was used, in which 
+*                     case the game is left out of stats.
 *____________________________________________________________
 * RETURNS:
 *    Void: Outputs the result of the guess, updates the game 
 *          status, and records the game result.
 ************************************************************/
-void compareGuess(list<char>& guess, const string& guess_input, 
-                  const list<char>& code, bool& endGame, stack<int>& turns,
-                  const int &length, const char &choiceDuplicate,
-                  queue<GameResult>& resultsQueue){
-    guess.clear();
-    for (char ch : guess_input){ 
-        guess.push_back(ch);
+void compareGuess(Game& game, Code guess, bool& endGame, Statistics& stats,
+                  Advisor& advisor, bool assisted){
+    GameState state = game.play(guess);
+
+    if (state == GAME_WON) {
+        cout << "Congratulations!! You win !!" << endl; 
+    } else {
+        printHint(game.lastTurn().hint, game.length());
+        cout << "Turns left: " << game.turnsLeft() << endl;
     }
 
-    if (code == guess) {
+    if (state != GAME_IN_PROGRESS) {
         endGame = true;
-        recordResult(length, choiceDuplicate, true, resultsQueue); // Record win
-        cout << "Congratulations!! You win !!" << endl; 
-        while(!turns.empty()){
-            turns.pop();
+        if (assisted) {
+            cout << "The solver helped with this game, so it is not counted "
+                    "in the statistics." << endl;
+        } else {
+            stats.record(game); // Record win or loss
         }
     } else {
-        hint(code, guess);
-        if (!turns.empty()) {
-            turns.pop();
-            cout << "Turns left: " << (turns.empty() ? 0 : turns.top()) << endl;
-            if(turns.empty()){
-                //cout << "\t\tTURNS ARE EMPTY" << endl;
-                recordResult(length, choiceDuplicate, false, resultsQueue); // Record loss
-            }
-        }
-
+        advisor.update(game);
     }
 }
 
@@ -608,30 +554,6 @@ void  exitingGame(bool &quit){
     }    
 }
 
-/************************************************************
-* FUNCTION: recordResult
-*____________________________________________________________
-* PURPOSE:
-*    Records the outcome of a single game (win/loss) and its 
-*    settings into a queue for tracking game results.
-*
-* PARAMETERS:
-*    - int codeLength: The code's length used in the game.
-*    - char duplicateSetting: The setting for duplicates ('y' 
-*                             or 'n').
-*    - bool isWin: True if user won the game, false if lost.
-*    - queue<GameResult>& resultsQueue: Reference to queue 
-*                                       where game results
-*                                       are stored.
-*____________________________________________________________
-* RETURNS:
-*    Void: Adds the game result to the resultsQueue.
-************************************************************/
-void recordResult(int codeLength, char duplicateSetting, bool isWin, 
-                  queue<GameResult> &resultsQueue) {
-    resultsQueue.push(GameResult(codeLength, duplicateSetting, isWin));
-}
-
 /************************************************************
 * FUNCTION: displayStatistics
 *____________________________________________________________
@@ -642,47 +564,25 @@ void recordResult(int codeLength, char duplicateSetting, bool isWin,
 *    with and without duplicates.
 *
 * PARAMETERS:
-*    - queue<GameResult>& resultsQueue: A reference to the 
-*                                       queue containing the
-*                                       results of previous 
-*                                       games to be analyzed.
+*    - const Statistics& stats: The results of previous games
+*                               to be analyzed.
 *____________________________________________________________
 * RETURNS:
 *    Void: Outputs game statistics to the console.
 ************************************************************/
-void displayStatistics(queue<GameResult> &resultsQueue) {
-    static int wins_4[2] = {0, 0}, losses_4[2] = {0, 0};
-    static int wins_6[2] = {0, 0}, losses_6[2] = {0, 0};
-    static int wins_8[2] = {0, 0}, losses_8[2] = {0, 0};
-
-    // Process results in the queue
-    while (!resultsQueue.empty()) {
-        GameResult result = resultsQueue.front();
-        resultsQueue.pop();
-
-        int dupIndex = (result.duplicateSetting == 'y') ? 1 : 0;
-        if (result.isWin) {
-            if (result.codeLength == 4) wins_4[dupIndex]++;
-            else if (result.codeLength == 6) wins_6[dupIndex]++;
-            else if (result.codeLength == 8) wins_8[dupIndex]++;
-        } else {
-            if (result.codeLength == 4) losses_4[dupIndex]++;
-            else if (result.codeLength == 6) losses_6[dupIndex]++;
-            else if (result.codeLength == 8) losses_8[dupIndex]++;
-        }
-    }
-
+void displayStatistics(const Statistics &stats) {
     // Output results
     cout << "\nGame Statistics:\n";
-    cout << "Code Length 4: Wins [No Dup: " << wins_4[0] << ", Dup: " << wins_4[1] << "], "
-         << "Losses [No Dup: " << losses_4[0] << ", Dup: " << losses_4[1] << "]\n";
-    cout << "Code Length 6: Wins [No Dup: " << wins_6[0] << ", Dup: " << wins_6[1] << "], "
-         << "Losses [No Dup: " << losses_6[0] << ", Dup: " << losses_6[1] << "]\n";
-    cout << "Code Length 8: Wins [No Dup: " << wins_8[0] << ", Dup: " << wins_8[1] << "], "
-         << "Losses [No Dup: " << losses_8[0] << ", Dup: " << losses_8[1] << "]\n";
+    for (int length = 4; length <= 8; length += 2) {
+        cout << "Code Length " << length << ": Wins [No Dup: " 
+             << stats.wins(length, 'n') << ", Dup: " << stats.wins(length, 'y') 
+             << "], Losses [No Dup: " << stats.losses(length, 'n') 
+             << ", Dup: " << stats.losses(length, 'y') << "]\n";
+    }
     
     // Use max_element and min_element to find the most and least wins for duplicates vs no-duplicates
-    int wins[] = {wins_4[0] + wins_6[0] + wins_8[0], wins_4[1] + wins_6[1] + wins_8[1]};
+    int wins[] = {stats.wins(4, 'n') + stats.wins(6, 'n') + stats.wins(8, 'n'), 
+                  stats.wins(4, 'y') + stats.wins(6, 'y') + stats.wins(8, 'y')};
     int* maxWins = max_element(wins, wins + 2);
     int* minWins = min_element(wins, wins + 2);
     
@@ -751,4 +651,162 @@ void printGameOver(){
     cout << " #     # #     # #     # #             #     #    # #   #       #    #  " << endl;
     cout << "  #####  #     # #     # #######       #######     #    ####### #     # " << endl;
     cout << endl;
-}
\ No newline at end of file
+}
+
+/************************************************************
+* FUNCTION: runTournamentMode
+*____________________________________________________________
+* PURPOSE:
+*    Generates a seeded set of secrets with genCode, the same
+*    way the console game does, and plays every strategy on
+*    all of them in parallel.
+*
+* PARAMETERS:
+*    - int argc, char* argv[]: The program's arguments, read
+*      as --tournament [length] [y|n] [games] [seed] [tree 
+*      file]. Missing values default to 4, y, 100 and 17. A 
+*      tree file from --compile-tree enters the tournament as
+*      the strategy "tree".
+*____________________________________________________________
+* RETURNS:
+*    int: Exit status, non-zero if an argument was invalid.
+************************************************************/
+int runTournamentMode(int argc, char* argv[]) {
+    int length = (argc > 2) ? atoi(argv[2]) : 4;
+    char choiceDuplicate = (argc > 3) ? tolower(argv[3][0]) : 'y';
+    int games = (argc > 4) ? atoi(argv[4]) : 100;
+    unsigned seed = (argc > 5) ? strtoul(argv[5], nullptr, 10) : 17;
+
+    if ((length != 4 && length != 6 && length != 8) ||
+        (choiceDuplicate != 'y' && choiceDuplicate != 'n') || games < 1) {
+        cout << "Usage: " << argv[0] 
+             << " --tournament [4|6|8] [y|n] [games] [seed] [tree file]" 
+             << endl;
+        return 1;
+    }
+
+    CodeSpace space(length, choiceDuplicate);
+    vector<TournamentEntry> entries;
+    tournamentEntries(strategyNames(), seed, entries);
+    DecisionTree tree;
+    if (argc > 6) {
+        if (!tree.open(argv[6]) || 
+            tree.header().length != static_cast<uint32_t>(length) ||
+            (tree.header().duplicates != 0) != space.duplicates()) {
+            cout << "Error: " << argv[6] << " is not a decision tree for "
+                 << "length " << length << ", duplicates " << choiceDuplicate
+                 << "." << endl;
+            return 1;
+        }
+        entries.push_back(TournamentEntry{"tree", [&tree](Arena&) {
+            return unique_ptr<Strategy>(new TreeStrategy(tree));
+        }});
+    }
+
+    srand(seed);
+    vector<Code> secrets;
+    for (int i = 0; i < games; i++) {
+        secrets.push_back(genCode(length, choiceDuplicate));
+    }
+
+    vector<TournamentResult> results;
+    if (!runTournament(space, secrets, entries, results)) {
+        cout << "Error: A tournament entrant could not be built." << endl;
+        return 1;
+    }
+    displayTournament(results, length, choiceDuplicate, games);
+    return 0;
+}
+
+/************************************************************
+* FUNCTION: runCompileTreeMode
+*____________________________________________________________
+* PURPOSE:
+*    Compiles a deterministic strategy into a decision tree 
+*    covering every secret of one setting and saves it for 
+*    --tournament to play. Saved under treeCacheName() in the
+*    working directory, the console game's 'suggest' uses it.
+*
+* PARAMETERS:
+*    - int argc, char* argv[]: The program's arguments, read
+*      as --compile-tree <strategy> <length> <y|n> <file>.
+*____________________________________________________________
+* RETURNS:
+*    int: Exit status, non-zero if compiling or saving 
+*         failed.
+************************************************************/
+int runCompileTreeMode(int argc, char* argv[]) {
+    if (argc != 6) {
+        cout << "Usage: " << argv[0] 
+             << " --compile-tree <strategy> <4|6|8> <y|n> <tree file>" << endl;
+        return 1;
+    }
+    string strategyName = argv[2];
+    int length = atoi(argv[3]);
+    char choiceDuplicate = tolower(argv[4][0]);
+    if ((length != 4 && length != 6 && length != 8) ||
+        (choiceDuplicate != 'y' && choiceDuplicate != 'n')) {
+        cout << "Error: Invalid code length or duplicate choice." << endl;
+        return 1;
+    }
+
+    CodeSpace space(length, choiceDuplicate);
+    vector<uint32_t> nodes;
+    time_t start = time(0);
+    if (!compileTree(space, strategyName, nodes)) {
+        cout << "Error: '" << strategyName << "' is not a deterministic "
+                "strategy." << endl;
+        return 1;
+    }
+    if (!writeTree(argv[5], space, strategyName, nodes)) {
+        cout << "Error: Could not write " << argv[5] << "." << endl;
+        return 1;
+    }
+
+    cout << "Compiled " << strategyName << " for length " << length 
+         << ", duplicates " << choiceDuplicate << ": " 
+         << nodes.size() / (1 + treeSlots(length)) << " nodes, "
+         << sizeof(TreeHeader) + nodes.size() * sizeof(uint32_t) 
+         << " bytes in " << difftime(time(0), start) << "s." << endl;
+    return 0;
+}
+
+/************************************************************
+* FUNCTION: displayTournament
+*____________________________________________________________
+* PURPOSE:
+*    Prints one row per strategy: average and worst guesses,
+*    win rate within the turn limit and CPU time per move, 
+*    then a note for any strategy that did not play every 
+*    secret.
+*
+* PARAMETERS:
+*    - const vector<TournamentResult>& results: Rows to print.
+*    - int length: Code length that was played.
+*    - char choiceDuplicate: Duplicate setting that was played.
+*    - int games: Number of secrets dealt to each strategy.
+*____________________________________________________________
+* RETURNS:
+*    Void: Outputs the tournament table to the console.
+************************************************************/
+void displayTournament(const vector<TournamentResult>& results, int length,
+                       char choiceDuplicate, int games) {
+    cout << "\nTournament: length " << length << ", duplicates " 
+         << choiceDuplicate << ", " << games << " secrets\n";
+    cout << left << setw(10) << "Strategy" << right 
+         << setw(10) << "Average" << setw(8) << "Worst" 
+         << setw(10) << "Win %" << setw(14) << "CPU us/move" << endl;
+    for (const TournamentResult& result : results) {
+        cout << left << setw(10) << result.name << right << fixed
+             << setprecision(3) << setw(10) << result.averageGuesses
+             << setw(8) << result.worstGuesses
+             << setprecision(1) << setw(10) << result.winRate * 100
+             << setprecision(2) << setw(14) << result.cpuMicrosPerMove << endl;
+    }
+    for (const TournamentResult& result : results) {
+        if (result.games < games) {
+            cout << "Note: " << result.name << " played only " << result.games
+                 << " of " << games << " secrets (out of memory)." << endl;
+        }
+    }
+}
@@ -0,0 +1,504 @@
+/******************************************
+* Author    : Bryan Estrada               *
+* Teacher   : Dr. Mark Lehr               *
+* Class     : CSC-17C                     *
+* Assignment: Project #1                  *
+* Title     : Mastermind Solver Strategies*
+******************************************/
+
+//Libraries
+#include "Strategy.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <time.h>    // clock_gettime for per-thread CPU time
+using namespace std;
+
+//Global Constants
+const int MAX_SIMULATED_TURNS = 64; // Give up on a secret after this
+
+/************************************************************
+* FUNCTION: CodeSpace::CodeSpace
+*____________________________________________________________
+* PURPOSE:
+*    Enumerates every valid secret for a setting: all 8^length
+*    codes with duplicates, or every permutation rank turned
+*    back into its code without, so the 8^length codes with
+*    repeats are never visited.
+*
+* PARAMETERS:
+*    - int length: Code length (4, 6 or 8).
+*    - char duplicates: 'y' if digits may repeat, 'n' if not.
+************************************************************/
+CodeSpace::CodeSpace(int length, char duplicates) {
+    codeLength = length;
+    allowDuplicates = (tolower(duplicates) == 'y');
+
+    if (allowDuplicates) {
+        codes.resize(size_t(1) << (3 * length));
+        for (size_t code = 0; code < codes.size(); code++) {
+            codes[code] = static_cast<Code>(code);
+        }
+    } else {
+        codes.resize(permutationCount(length));
+        for (size_t rank = 0; rank < codes.size(); rank++) {
+            codes[rank] = unrankPermutation(static_cast<unsigned>(rank), length);
+        }
+    }
+}
+
+/************************************************************
+* FUNCTION: FeedbackTable::FeedbackTable
+*____________________________________________________________
+* PURPOSE:
+*    Scores every pair of codes in the space once.
+*
+* PARAMETERS:
+*    - const CodeSpace& space: The space to tabulate; must
+*                              outlive the table.
+************************************************************/
+FeedbackTable::FeedbackTable(const CodeSpace& space) : codes(space) {
+    size_t n = space.size();
+    slots.resize(n * n);
+    for (size_t g = 0; g < n; g++) {
+        for (size_t s = 0; s < n; s++) {
+            slots[g * n + s] = static_cast<unsigned char>(
+                hintIndex(scoreCodes(space.code(s), space.code(g),
+                                     space.length())));
+        }
+    }
+}
+
+/************************************************************
+* FUNCTION: CandidateStrategy::reset
+*____________________________________________________________
+* PURPOSE:
+*    Starts a new game: every secret in the space is again a
+*    candidate. The list only comes from the arena when the
+*    space outgrows the one already held.
+*
+* PARAMETERS:
+*    - const CodeSpace& space: The setting being played.
+*____________________________________________________________
+* RETURNS:
+*    bool: False if the arena could not hold the list.
+************************************************************/
+bool CandidateStrategy::reset(const CodeSpace& space) {
+    return reset(space.begin(), space.size(), space.length());
+}
+
+/************************************************************
+* FUNCTION: CandidateStrategy::reset
+*____________________________________________________________
+* PURPOSE:
+*    Starts a game part way, from candidates already
+*    narrowed elsewhere, e.g. by a precomputed split.
+*
+* PARAMETERS:
+*    - const Code* list: The candidates, in space order.
+*    - size_t size: How many there are.
+*    - int codeLength: The code length.
+*____________________________________________________________
+* RETURNS:
+*    bool: False if the arena could not hold the list.
+************************************************************/
+bool CandidateStrategy::reset(const Code* list, size_t size, int codeLength) {
+    length = codeLength;
+    count = 0;
+    if (size > capacity) {
+        candidates = arena.allocateArray<Code>(size);
+        capacity = candidates ? size : 0;
+        if (!candidates) return false;
+    }
+    copy(list, list + size, candidates);
+    count = size;
+    return true;
+}
+
+/************************************************************
+* FUNCTION: CandidateStrategy::nextGuess
+*____________________________________________________________
+* PURPOSE:
+*    Asks the subclass which consistent candidate to play.
+*____________________________________________________________
+* RETURNS:
+*    Code: The next guess.
+************************************************************/
+Code CandidateStrategy::nextGuess() {
+    return candidates[choose(candidates, count)];
+}
+
+/************************************************************
+* FUNCTION: CandidateStrategy::observe
+*____________________________________________________________
+* PURPOSE:
+*    Drops every candidate that would not have produced the
+*    hint the guess earned, compacting the list in place.
+*
+* PARAMETERS:
+*    - Code guess: The guess that was played.
+*    - const Hint& hint: The hint it earned.
+************************************************************/
+void CandidateStrategy::observe(Code guess, const Hint& hint) {
+    int expected = hintIndex(hint);
+    int len = length;
+    count = remove_if(candidates, candidates + count,
+                      [=](Code c) {
+                          return hintIndex(scoreCodes(c, guess, len))
+                                 != expected;
+                      }) - candidates;
+}
+
+/************************************************************
+* FUNCTION: RandomConsistentStrategy::choose
+*____________________________________________________________
+* PURPOSE:
+*    Picks a uniformly random candidate.
+*____________________________________________________________
+* RETURNS:
+*    size_t: Index of the chosen candidate.
+************************************************************/
+size_t RandomConsistentStrategy::choose(const Code*, size_t count) {
+    return uniform_int_distribution<size_t>(0, count - 1)(rng);
+}
+
+/************************************************************
+* FUNCTION: walkStride
+*____________________________________________________________
+* PURPOSE:
+*    Picks the step of an index walk that visits limit of
+*    count candidates. An even stride over a space in packed
+*    base-8 order is a power of two and keeps every pick on
+*    one digit prefix, so large lists are walked by a step
+*    near count / golden ratio, coprime to count, which
+*    never repeats an index and spreads over every digit.
+*
+* PARAMETERS:
+*    - size_t count: Length of the list walked.
+*    - size_t limit: Indices wanted from it.
+*____________________________________________________________
+* RETURNS:
+*    size_t: 1 if the whole list fits, else the step; the
+*            walk is (k * step) % count for k < limit.
+************************************************************/
+static size_t walkStride(size_t count, size_t limit) {
+    if (count <= limit) return 1;
+    size_t stride = static_cast<size_t>(count * 0.6180339887) | 1;
+    while (true) {
+        size_t a = count, b = stride;
+        while (b != 0) {
+            size_t r = a % b;
+            a = b;
+            b = r;
+        }
+        if (a == 1) return stride;
+        stride += 2;
+    }
+}
+
+/************************************************************
+* FUNCTION: ScoringStrategy::choose
+*____________________________________________________________
+* PURPOSE:
+*    Counts, for each guess in the pool, how many sampled
+*    candidates fall into each hint group and keeps the guess
+*    the subclass rates lowest.
+*
+* PARAMETERS:
+*    - const Code* candidates: The consistent candidates.
+*    - size_t count: Number of candidates.
+*____________________________________________________________
+* RETURNS:
+*    size_t: Index of the chosen candidate.
+************************************************************/
+size_t ScoringStrategy::choose(const Code* candidates, size_t count) {
+    if (count <= 2) return 0;   // Any guess splits two candidates equally
+
+    size_t poolSize = min(count, MAX_GUESS_POOL);
+    size_t sampleSize = min(count, MAX_SCORE_SAMPLE);
+    size_t guessStride = walkStride(count, MAX_GUESS_POOL);
+    size_t sampleStride = walkStride(count, MAX_SCORE_SAMPLE);
+    size_t best = 0;
+    double bestRating = 0;
+    int groups[HINT_SLOTS];
+    Code sample[MAX_SCORE_SAMPLE];
+    size_t sampleIndex[MAX_SCORE_SAMPLE];   // Table columns of the sample
+
+    for (size_t k = 0, s = 0; k < sampleSize;
+         k++, s = (s + sampleStride) % count) {
+        sample[k] = candidates[s];
+        if (feedback) sampleIndex[k] = feedback->space().index(sample[k]);
+    }
+
+    for (size_t k = 0, g = 0; k < poolSize;
+         k++, g = (g + guessStride) % count) {
+        fill(groups, groups + HINT_SLOTS, 0);
+        if (feedback) {
+            const unsigned char* row =
+                feedback->row(feedback->space().index(candidates[g]));
+            for (size_t i = 0; i < sampleSize; i++) {
+                groups[row[sampleIndex[i]]]++;
+            }
+        } else {
+            for (size_t i = 0; i < sampleSize; i++) {
+                groups[hintIndex(scoreCodes(sample[i], candidates[g],
+                                            length))]++;
+            }
+        }
+        double rating = rate(groups, static_cast<int>(sampleSize));
+        if (k == 0 || rating < bestRating) {
+            best = g;
+            bestRating = rating;
+        }
+    }
+    return best;
+}
+
+/************************************************************
+* FUNCTION: MinimaxStrategy::rate
+*____________________________________________________________
+* RETURNS:
+*    double: Size of the largest hint group.
+************************************************************/
+double MinimaxStrategy::rate(const int* groups, int) const {
+    return *max_element(groups, groups + HINT_SLOTS);
+}
+
+/************************************************************
+* FUNCTION: ExpectedSizeStrategy::rate
+*____________________________________________________________
+* RETURNS:
+*    double: Expected size of the group the secret lands in.
+************************************************************/
+double ExpectedSizeStrategy::rate(const int* groups, int sampled) const {
+    double sumSquares = 0;
+    for (int i = 0; i < HINT_SLOTS; i++) {
+        sumSquares += static_cast<double>(groups[i]) * groups[i];
+    }
+    return sumSquares / sampled;
+}
+
+/************************************************************
+* FUNCTION: EntropyStrategy::rate
+*____________________________________________________________
+* RETURNS:
+*    double: Sum of n*log2(n) over the groups, which is lowest
+*            exactly when the hint's entropy is highest.
+************************************************************/
+double EntropyStrategy::rate(const int* groups, int) const {
+    double sum = 0;
+    for (int i = 0; i < HINT_SLOTS; i++) {
+        if (groups[i] > 1) sum += groups[i] * log2(groups[i]);
+    }
+    return sum;
+}
+
+/************************************************************
+* FUNCTION: strategyNames
+*____________________________________________________________
+* RETURNS:
+*    const vector<string>&: Names createStrategy accepts, in
+*                           the order tournaments report them.
+************************************************************/
+const vector<string>& strategyNames() {
+    static const vector<string> names = {"random", "first", "minimax",
+                                         "expected", "entropy"};
+    return names;
+}
+
+/************************************************************
+* FUNCTION: strategyArenaBytes
+*____________________________________________________________
+* PURPOSE:
+*    Sizes the arena one strategy needs to play a setting.
+*
+* PARAMETERS:
+*    - const CodeSpace& space: The setting to be played.
+*____________________________________________________________
+* RETURNS:
+*    size_t: Bytes, including room for alignment.
+************************************************************/
+size_t strategyArenaBytes(const CodeSpace& space) {
+    return space.size() * sizeof(Code) + alignof(Code);
+}
+
+/************************************************************
+* FUNCTION: createStrategy
+*____________________________________________________________
+* PURPOSE:
+*    Builds a strategy by name.
+*
+* PARAMETERS:
+*    - const string& name: One of strategyNames().
+*    - unsigned seed: Seed for strategies that use randomness.
+*    - Arena& arena: Where the strategy takes its memory from;
+*                    must outlive the strategy.
+*____________________________________________________________
+* RETURNS:
+*    unique_ptr<Strategy>: The strategy, or null if the name
+*                          is unknown.
+************************************************************/
+unique_ptr<Strategy> createStrategy(const string& name, unsigned seed,
+                                    Arena& arena) {
+    if (name == "random")   return unique_ptr<Strategy>(new RandomConsistentStrategy(arena, seed));
+    if (name == "first")    return unique_ptr<Strategy>(new FirstConsistentStrategy(arena));
+    if (name == "minimax")  return unique_ptr<Strategy>(new MinimaxStrategy(arena));
+    if (name == "expected") return unique_ptr<Strategy>(new ExpectedSizeStrategy(arena));
+    if (name == "entropy")  return unique_ptr<Strategy>(new EntropyStrategy(arena));
+    return unique_ptr<Strategy>();
+}
+
+/************************************************************
+* FUNCTION: threadCpuMicros
+*____________________________________________________________
+* RETURNS:
+*    double: CPU time consumed so far by the calling thread,
+*            in microseconds.
+************************************************************/
+static double threadCpuMicros() {
+    timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return now.tv_sec * 1e6 + now.tv_nsec / 1e3;
+}
+
+/************************************************************
+* FUNCTION: playSecrets
+*____________________________________________________________
+* PURPOSE:
+*    Lets one strategy crack every secret in turn and sums up
+*    how it did. Only nextGuess and observe are timed; the
+*    per-game reset is setup, not a move. If reset() fails the
+*    remaining secrets are skipped, which shows as games
+*    falling short of the number of secrets.
+*
+* PARAMETERS:
+*    - Strategy& strategy: The strategy to play.
+*    - const CodeSpace& space: The setting being played.
+*    - const vector<Code>& secrets: The secrets to crack.
+*____________________________________________________________
+* RETURNS:
+*    TournamentResult: The strategy's totals.
+************************************************************/
+static TournamentResult playSecrets(Strategy& strategy,
+                                    const CodeSpace& space,
+                                    const vector<Code>& secrets) {
+    TournamentResult result = {strategy.name(), 0, 0, 0, 0, 0};
+    long totalGuesses = 0;
+    int wins = 0;
+    double cpuMicros = 0;
+
+    for (Code secret : secrets) {
+        if (!strategy.reset(space)) break;
+        int guesses = 0;
+        bool solved = false;
+        while (!solved && guesses < MAX_SIMULATED_TURNS) {
+            double start = threadCpuMicros();
+            Code guess = strategy.nextGuess();
+            Hint hint = scoreCodes(secret, guess, space.length());
+            solved = (hint.correct == space.length());
+            if (!solved) strategy.observe(guess, hint);
+            cpuMicros += threadCpuMicros() - start;
+            guesses++;
+        }
+        totalGuesses += guesses;
+        result.worstGuesses = max(result.worstGuesses, guesses);
+        if (solved && guesses <= MAX_TURNS) wins++;
+        result.games++;
+    }
+
+    if (result.games > 0) {
+        result.averageGuesses = static_cast<double>(totalGuesses) / result.games;
+        result.winRate = static_cast<double>(wins) / result.games;
+        result.cpuMicrosPerMove = cpuMicros / totalGuesses;
+    }
+    return result;
+}
+
+/************************************************************
+* FUNCTION: tournamentEntries
+*____________________________________________________________
+* PURPOSE:
+*    Turns strategy names into tournament entrants built by
+*    createStrategy.
+*
+* PARAMETERS:
+*    - const vector<string>& names: Names from strategyNames().
+*    - unsigned seed: Seed for randomized strategies.
+*    - vector<TournamentEntry>& entries: Receives the entrants,
+*                                        appended in order.
+*____________________________________________________________
+* RETURNS:
+*    bool: False, with nothing appended, if a name is unknown.
+************************************************************/
+bool tournamentEntries(const vector<string>& names, unsigned seed,
+                       vector<TournamentEntry>& entries) {
+    const vector<string>& known = strategyNames();
+    for (const string& name : names) {
+        if (find(known.begin(), known.end(), name) == known.end()) {
+            return false;
+        }
+    }
+    for (const string& name : names) {
+        entries.push_back(TournamentEntry{name, [name, seed](Arena& arena) {
+            return createStrategy(name, seed, arena);
+        }});
+    }
+    return true;
+}
+
+/************************************************************
+* FUNCTION: runTournament
+*____________________________________________________________
+* PURPOSE:
+*    Plays every entrant against the same secrets, one thread
+*    per entrant, so the results compare like with like. Each
+*    thread gives its strategy a private arena; on spaces
+*    small enough they share one FeedbackTable.
+*
+* PARAMETERS:
+*    - const CodeSpace& space: The setting being played.
+*    - const vector<Code>& secrets: The shared secrets.
+*    - const vector<TournamentEntry>& entries: The entrants.
+*    - vector<TournamentResult>& results: Receives one result
+*                                         per entrant, in order.
+*____________________________________________________________
+* RETURNS:
+*    bool: False, with nothing played, if an entrant has no
+*          factory.
+************************************************************/
+bool runTournament(const CodeSpace& space, const vector<Code>& secrets,
+                   const vector<TournamentEntry>& entries,
+                   vector<TournamentResult>& results) {
+    for (const TournamentEntry& entry : entries) {
+        if (!entry.create) return false;
+    }
+
+    results.assign(entries.size(), TournamentResult());
+    vector<thread> players;
+    unique_ptr<FeedbackTable> table;
+    if (space.size() <= MAX_FEEDBACK_CODES) {
+        table.reset(new FeedbackTable(space));
+    }
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        players.emplace_back([&, i]() {
+            vector<unsigned char> buffer(strategyArenaBytes(space));
+            Arena arena(buffer.data(), buffer.size());
+            unique_ptr<Strategy> strategy = entries[i].create(arena);
+            if (!strategy) {
+                results[i] = TournamentResult{entries[i].name, 0, 0, 0, 0, 0};
+                return;
+            }
+            if (ScoringStrategy* scoring =
+                    dynamic_cast<ScoringStrategy*>(strategy.get())) {
+                scoring->useTable(table.get());
+            }
+            results[i] = playSecrets(*strategy, space, secrets);
+            results[i].name = entries[i].name;
+        });
+    }
+    for (thread& player : players) {
+        player.join();
+    }
+    return true;
+}
@@ -0,0 +1,286 @@
+/******************************************
+* Author    : Bryan Estrada               *
+* Teacher   : Dr. Mark Lehr               *
+* Class     : CSC-17C                     *
+* Assignment: Project #1                  *
+* Title     : Mastermind Solver Strategies*
+******************************************/
+
+#ifndef STRATEGY_H
+#define STRATEGY_H
+
+//Libraries
+#include "Mastermind.h"
+#include <string>
+#include <vector>
+#include <functional>
+#include <memory>
+#include <random>
+
+//Global Constants
+const size_t MAX_GUESS_POOL = 1024; // Guesses rated per move by scorers
+const size_t MAX_SCORE_SAMPLE = 4096; // Candidates sampled per rating
+const size_t MAX_FEEDBACK_CODES = 4096; // Largest space given a FeedbackTable
+
+/************************************************************
+* CLASS: CodeSpace
+*____________________________________________________________
+* PURPOSE:
+*    Every valid secret for one (length, duplicates) setting,
+*    in ascending order. Built once and shared read-only by
+*    all strategies playing that setting. index() numbers
+*    only the valid codes: with duplicates a code is its own
+*    index, without them its permutation rank, so tables
+*    over a space without duplicates need 8P8 = 40320 rows
+*    at most instead of 8^8.
+************************************************************/
+class CodeSpace {
+public:
+    CodeSpace(int length, char duplicates);
+    int length() const { return codeLength; }
+    bool duplicates() const { return allowDuplicates; }
+    size_t size() const { return codes.size(); }
+    Code code(size_t index) const { return codes[index]; }
+    size_t index(Code code) const {
+        return allowDuplicates ? code : rankPermutation(code, codeLength);
+    }
+    const Code* begin() const { return codes.data(); }
+private:
+    int codeLength;
+    bool allowDuplicates;
+    std::vector<Code> codes;
+};
+
+/************************************************************
+* CLASS: FeedbackTable
+*____________________________________________________________
+* PURPOSE:
+*    The hintIndex of every guess against every secret of a
+*    space, one byte each, in rows by guess index. Only
+*    worthwhile while the space holds MAX_FEEDBACK_CODES codes
+*    or fewer (16 MB); read-only once built, so one table can
+*    serve every thread.
+************************************************************/
+class FeedbackTable {
+public:
+    explicit FeedbackTable(const CodeSpace& space);
+    const CodeSpace& space() const { return codes; }
+    const unsigned char* row(size_t guessIndex) const {
+        return slots.data() + guessIndex * codes.size();
+    }
+private:
+    const CodeSpace& codes;
+    std::vector<unsigned char> slots;
+};
+
+/************************************************************
+* CLASS: Strategy
+*____________________________________________________________
+* PURPOSE:
+*    Interface for an automatic code breaker. A strategy is
+*    reset at the start of each game, proposes a guess, then
+*    observes the hint that guess earned. reset() returns
+*    false if the strategy could not get the memory it needs.
+************************************************************/
+class Strategy {
+public:
+    virtual ~Strategy() {}
+    virtual const char* name() const = 0;
+    virtual bool deterministic() const { return true; }
+    virtual bool reset(const CodeSpace& space) = 0;
+    virtual Code nextGuess() = 0;
+    virtual void observe(Code guess, const Hint& hint) = 0;
+};
+
+/************************************************************
+* CLASS: CandidateStrategy
+*____________________________________________________________
+* PURPOSE:
+*    Base for strategies that keep the list of secrets still
+*    consistent with every hint seen so far and always guess
+*    one of them. Subclasses only decide which one. The list
+*    is taken from the arena on the first reset() and reused
+*    by later games, so moves never allocate. guessFor() asks
+*    the same question of any candidate list, which is how
+*    the tree compiler explores every game at once.
+************************************************************/
+class CandidateStrategy : public Strategy {
+public:
+    explicit CandidateStrategy(Arena& arena) : arena(arena) {}
+    bool reset(const CodeSpace& space);
+    bool reset(const Code* list, size_t size, int codeLength);
+    Code nextGuess();
+    void observe(Code guess, const Hint& hint);
+    size_t remaining() const { return count; }
+    Code guessFor(const Code* list, size_t size, int codeLength) {
+        length = codeLength;
+        return list[choose(list, size)];
+    }
+protected:
+    virtual size_t choose(const Code* candidates, size_t count) = 0;
+    int length = 0;
+private:
+    Arena& arena;
+    Code* candidates = nullptr;
+    size_t count = 0;
+    size_t capacity = 0;
+};
+
+/************************************************************
+* CLASS: RandomConsistentStrategy
+*____________________________________________________________
+* PURPOSE:
+*    Guesses a uniformly random consistent candidate.
+************************************************************/
+class RandomConsistentStrategy : public CandidateStrategy {
+public:
+    RandomConsistentStrategy(Arena& arena, unsigned seed)
+        : CandidateStrategy(arena), rng(seed) {}
+    const char* name() const { return "random"; }
+    bool deterministic() const { return false; }
+protected:
+    size_t choose(const Code* candidates, size_t count);
+private:
+    std::mt19937 rng;
+};
+
+/************************************************************
+* CLASS: FirstConsistentStrategy
+*____________________________________________________________
+* PURPOSE:
+*    Guesses the lowest consistent candidate.
+************************************************************/
+class FirstConsistentStrategy : public CandidateStrategy {
+public:
+    explicit FirstConsistentStrategy(Arena& arena)
+        : CandidateStrategy(arena) {}
+    const char* name() const { return "first"; }
+protected:
+    size_t choose(const Code*, size_t) { return 0; }
+};
+
+/************************************************************
+* CLASS: ScoringStrategy
+*____________________________________________________________
+* PURPOSE:
+*    Base for strategies that rate each candidate guess by
+*    how it would split the remaining candidates into hint
+*    groups, then play the lowest rating (first on ties).
+*    At most MAX_GUESS_POOL guesses are rated against at
+*    most MAX_SCORE_SAMPLE candidates, both picked by a
+*    walkStride() walk so they cover every digit prefix, and
+*    a move stays affordable on the 6 and 8 digit settings.
+*    Given a FeedbackTable, hints are looked up instead of
+*    scored.
+************************************************************/
+class ScoringStrategy : public CandidateStrategy {
+public:
+    explicit ScoringStrategy(Arena& arena) : CandidateStrategy(arena) {}
+    void useTable(const FeedbackTable* table) { feedback = table; }
+protected:
+    size_t choose(const Code* candidates, size_t count);
+    virtual double rate(const int* groups, int sampled) const = 0;
+private:
+    const FeedbackTable* feedback = nullptr;
+};
+
+/************************************************************
+* CLASS: MinimaxStrategy
+*____________________________________________________________
+* PURPOSE:
+*    Knuth's rule: minimize the largest hint group.
+************************************************************/
+class MinimaxStrategy : public ScoringStrategy {
+public:
+    explicit MinimaxStrategy(Arena& arena) : ScoringStrategy(arena) {}
+    const char* name() const { return "minimax"; }
+protected:
+    double rate(const int* groups, int sampled) const;
+};
+
+/************************************************************
+* CLASS: ExpectedSizeStrategy
+*____________________________________________________________
+* PURPOSE:
+*    Minimize the expected number of candidates left.
+************************************************************/
+class ExpectedSizeStrategy : public ScoringStrategy {
+public:
+    explicit ExpectedSizeStrategy(Arena& arena) : ScoringStrategy(arena) {}
+    const char* name() const { return "expected"; }
+protected:
+    double rate(const int* groups, int sampled) const;
+};
+
+/************************************************************
+* CLASS: EntropyStrategy
+*____________________________________________________________
+* PURPOSE:
+*    Maximize the information (entropy) of the hint.
+************************************************************/
+class EntropyStrategy : public ScoringStrategy {
+public:
+    explicit EntropyStrategy(Arena& arena) : ScoringStrategy(arena) {}
+    const char* name() const { return "entropy"; }
+protected:
+    double rate(const int* groups, int sampled) const;
+};
+
+/************************************************************
+* STRUCT: TournamentResult
+*____________________________________________________________
+* PURPOSE:
+*    How one strategy fared over every secret of a tournament.
+*
+* MEMBERS:
+*    - std::string name: The strategy's name.
+*    - int games: Secrets played; fewer than were dealt if
+*                 the strategy ran out of arena memory.
+*    - double averageGuesses: Mean guesses to crack a secret.
+*    - int worstGuesses: Most guesses any secret needed.
+*    - double winRate: Share of secrets cracked within
+*                      MAX_TURNS guesses (0 to 1).
+*    - double cpuMicrosPerMove: Thread CPU time spent in
+*                               nextGuess and observe, per
+*                               guess, in microseconds.
+************************************************************/
+struct TournamentResult {
+    std::string name;
+    int games;
+    double averageGuesses;
+    int worstGuesses;
+    double winRate;
+    double cpuMicrosPerMove;
+};
+
+/************************************************************
+* STRUCT: TournamentEntry
+*____________________________________________________________
+* PURPOSE:
+*    One entrant of a tournament. The factory is called once
+*    per tournament, on the entrant's own thread, with that
+*    thread's arena.
+*
+* MEMBERS:
+*    - std::string name: Name reported in the results.
+*    - StrategyFactory create: Builds the strategy; returning
+*                              null forfeits every game.
+************************************************************/
+typedef std::function<std::unique_ptr<Strategy>(Arena&)> StrategyFactory;
+
+struct TournamentEntry {
+    std::string name;
+    StrategyFactory create;
+};
+
+//Function prototypes
+const std::vector<std::string>& strategyNames();
+size_t strategyArenaBytes(const CodeSpace&);
+std::unique_ptr<Strategy> createStrategy(const std::string&, unsigned, Arena&);
+bool tournamentEntries(const std::vector<std::string>&, unsigned,
+                       std::vector<TournamentEntry>&);
+bool runTournament(const CodeSpace&, const std::vector<Code>&,
+                   const std::vector<TournamentEntry>&,
+                   std::vector<TournamentResult>&);
+
+#endif /* STRATEGY_H */
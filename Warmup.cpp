@@ -0,0 +1,413 @@
+/******************************************
+* Author    : Bryan Estrada               *
+* Teacher   : Dr. Mark Lehr               *
+* Class     : CSC-17C                     *
+* Assignment: Project #1                  *
+* Title     : Mastermind Solver Warmup    *
+******************************************/
+
+//Libraries
+#include "Warmup.h"
+#include <cctype>
+using namespace std;
+
+/************************************************************
+* FUNCTION: treeCacheName
+*____________________________________________________________
+* PURPOSE:
+*    Names the decision tree file the warmup looks for, e.g.
+*    "mastermind-4n.tree" for 4 digits without duplicates.
+*
+* PARAMETERS:
+*    - int length: The code length.
+*    - char duplicates: 'y' or 'n'.
+*____________________________________________________________
+* RETURNS:
+*    string: The file name, without a directory.
+************************************************************/
+string treeCacheName(int length, char duplicates) {
+    return "mastermind-" + to_string(length) +
+           static_cast<char>(tolower(duplicates)) + ".tree";
+}
+
+/************************************************************
+* FUNCTION: Advisor::newGame
+*____________________________________________________________
+* PURPOSE:
+*    Stops following the previous game. If the new game is
+*    of another setting, the strategy and its arena are
+*    freed too: the Warmup frees the old setting's state,
+*    which the strategy still points into.
+*
+* PARAMETERS:
+*    - const Game& game: The game just started.
+************************************************************/
+void Advisor::newGame(const Game& game) {
+    following = false;
+    if (current && (heldLength != game.length() ||
+                    heldDuplicates != (tolower(game.duplicates()) == 'y'))) {
+        current = nullptr;
+        strategy.reset();
+        vector<unsigned char>().swap(buffer);
+        arena = Arena(nullptr, 0);
+    }
+}
+
+/************************************************************
+* FUNCTION: Advisor::update
+*____________________________________________________________
+* PURPOSE:
+*    Narrows the candidates by the turns played since the
+*    last call. Does nothing until the game's first
+*    suggestion past the tree, so players who never ask pay
+*    nothing.
+*
+* PARAMETERS:
+*    - const Game& game: The game in progress.
+************************************************************/
+void Advisor::update(const Game& game) {
+    if (!following) return;
+    for (; seen < game.turnsUsed(); seen++) {
+        strategy->observe(game.turn(seen).guess, game.turn(seen).hint);
+    }
+}
+
+/************************************************************
+* FUNCTION: Advisor::suggest
+*____________________________________________________________
+* PURPOSE:
+*    Proposes the next guess for a game in progress: the
+*    cached tree's while the player has followed it, the
+*    precomputed opening on the first turn, and otherwise
+*    minimax over the candidates left.
+*
+* PARAMETERS:
+*    - const SolverState& solver: State for the game's
+*                                 setting.
+*    - const Game& game: The game in progress.
+*    - Code& guess: Receives the suggestion.
+*____________________________________________________________
+* RETURNS:
+*    bool: False if the candidate list could not be held.
+************************************************************/
+bool Advisor::suggest(const SolverState& solver, const Game& game,
+                      Code& guess) {
+    TreeStrategy walk(solver.tree);
+    if (walk.reset(solver.space)) {
+        int t = 0;
+        while (t < game.turnsUsed() && walk.followingTree() &&
+               game.turn(t).guess == walk.nextGuess()) {
+            walk.observe(game.turn(t).guess, game.turn(t).hint);
+            t++;
+        }
+        if (t == game.turnsUsed() && walk.followingTree()) {
+            guess = walk.nextGuess();
+            return true;
+        }
+    }
+    if (game.turnsUsed() == 0) {
+        guess = solver.opening;
+        return true;
+    }
+
+    if (!following || current != &solver) {
+        if (!follow(solver, game)) return false;
+    }
+    update(game);
+    guess = strategy->nextGuess();
+    return true;
+}
+
+/************************************************************
+* FUNCTION: Advisor::follow
+*____________________________________________________________
+* PURPOSE:
+*    Starts tracking a game that has at least one turn. If
+*    it opened with the precomputed opening, the candidates
+*    are that hint's group of the split; otherwise the whole
+*    space, narrowed by update(). The arena and strategy are
+*    only rebuilt when the setting changes, holding the
+*    whole space from the start so any later reset fits.
+*
+* PARAMETERS:
+*    - const SolverState& solver: State for the game's
+*                                 setting.
+*    - const Game& game: The game in progress.
+*____________________________________________________________
+* RETURNS:
+*    bool: False if the arena could not hold the list.
+************************************************************/
+bool Advisor::follow(const SolverState& solver, const Game& game) {
+    following = false;
+    if (current != &solver) {
+        current = nullptr;
+        strategy.reset();
+        buffer.resize(strategyArenaBytes(solver.space));
+        arena = Arena(buffer.data(), buffer.size());
+        strategy.reset(new MinimaxStrategy(arena));
+        strategy->useTable(solver.table.get());
+        if (!strategy->reset(solver.space)) return false;
+        current = &solver;
+        heldLength = solver.space.length();
+        heldDuplicates = solver.space.duplicates();
+    }
+
+    const Turn& first = game.turn(0);
+    if (first.guess == solver.opening && !solver.split.empty()) {
+        int h = hintIndex(first.hint);
+        following = strategy->reset(solver.split.data() + solver.splitBounds[h],
+                                    solver.splitBounds[h + 1] -
+                                        solver.splitBounds[h],
+                                    game.length());
+        seen = 1;
+    } else {
+        following = strategy->reset(solver.space);
+        seen = 0;
+    }
+    return following;
+}
+
+/************************************************************
+* FUNCTION: splitOpening
+*____________________________________________________________
+* PURPOSE:
+*    Groups the space by the hint each secret gives the
+*    opening guess, with a stable counting sort, so the
+*    candidates left after the opening are a slice.
+*
+* PARAMETERS:
+*    - SolverState& state: Its opening is set; fills split
+*                          and splitBounds.
+*____________________________________________________________
+* RETURNS:
+*    bool: False if the groups do not add up to the space;
+*          split is then left empty and the Advisor filters
+*          the whole space instead.
+************************************************************/
+bool splitOpening(SolverState& state) {
+    const CodeSpace& space = state.space;
+    vector<unsigned char> hintOf(space.size());
+    size_t size[HINT_SLOTS] = {0};
+    for (size_t i = 0; i < space.size(); i++) {
+        hintOf[i] = static_cast<unsigned char>(
+            hintIndex(scoreCodes(space.begin()[i], state.opening,
+                                 space.length())));
+        size[hintOf[i]]++;
+    }
+
+    size_t offset[HINT_SLOTS];
+    state.splitBounds[0] = 0;
+    for (int h = 0; h < HINT_SLOTS; h++) {
+        offset[h] = state.splitBounds[h];
+        state.splitBounds[h + 1] = state.splitBounds[h] + size[h];
+    }
+    state.split.resize(space.size());
+    for (size_t i = 0; i < space.size(); i++) {
+        state.split[offset[hintOf[i]]++] = space.begin()[i];
+    }
+
+    // Every code placed once, each group filled exactly to its end
+    bool whole = state.splitBounds[HINT_SLOTS] == space.size();
+    for (int h = 0; h < HINT_SLOTS && whole; h++) {
+        whole = offset[h] == state.splitBounds[h + 1];
+    }
+    if (!whole) state.split.clear();
+    return whole;
+}
+
+/************************************************************
+* FUNCTION: Warmup::Warmup
+*____________________________________________________________
+* PURPOSE:
+*    Marks every setting as wanted; nothing runs until
+*    start().
+************************************************************/
+Warmup::Warmup() {
+    stopping = false;
+    for (int i = 0; i < NUM_SETTINGS; i++) {
+        status[i] = PENDING;
+    }
+}
+
+/************************************************************
+* FUNCTION: Warmup::~Warmup
+*____________________________________________________________
+* PURPOSE:
+*    Stops the background thread once it finishes the step
+*    it is on, and waits for it.
+************************************************************/
+Warmup::~Warmup() {
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    if (worker.joinable()) worker.join();
+}
+
+/************************************************************
+* FUNCTION: Warmup::start
+*____________________________________________________________
+* PURPOSE:
+*    Launches the background thread. Calling it again does
+*    nothing.
+*
+* PARAMETERS:
+*    - const string& cacheDir: Directory searched for tree
+*                              files named by treeCacheName.
+************************************************************/
+void Warmup::start(const string& cacheDir) {
+    if (worker.joinable()) return;
+    directory = cacheDir;
+    worker = thread(&Warmup::run, this);
+}
+
+/************************************************************
+* FUNCTION: Warmup::select
+*____________________________________________________________
+* PURPOSE:
+*    Narrows the warmup to the settings that can still be
+*    played. Work on every other setting is cancelled and
+*    the states already prepared for them are freed, since
+*    the 8 digit ones hold well over 100 MB. A setting
+*    cancelled earlier is queued again if selected. States
+*    handed out by tryTake() for a setting ruled out here
+*    must no longer be used.
+*
+* PARAMETERS:
+*    - int length: The chosen code length.
+*    - char duplicates: 'y' or 'n', or '\0' while the player
+*                       has not answered yet.
+************************************************************/
+void Warmup::select(int length, char duplicates) {
+    unique_ptr<SolverState> dropped[NUM_SETTINGS];  // Freed unlocked
+    {
+        lock_guard<mutex> guard(lock);
+        for (int i = 0; i < NUM_SETTINGS; i++) {
+            bool wanted = (4 + 2 * (i / 2) == length) &&
+                          (duplicates == '\0' ||
+                           (i % 2 == 1) == (tolower(duplicates) == 'y'));
+            if (!wanted && status[i] != CANCELLED) {
+                dropped[i] = move(states[i]);
+                status[i] = CANCELLED;
+            } else if (wanted && status[i] == CANCELLED) {
+                status[i] = PENDING;
+            }
+        }
+    }
+    wake.notify_all();
+}
+
+/************************************************************
+* FUNCTION: Warmup::tryTake
+*____________________________________________________________
+* PURPOSE:
+*    Hands over a setting's state if it is ready, without
+*    waiting for it.
+*
+* PARAMETERS:
+*    - int length: The code length.
+*    - char duplicates: 'y' or 'n'.
+*____________________________________________________________
+* RETURNS:
+*    const SolverState*: The state, owned by the Warmup and
+*                        valid until select() rules its
+*                        setting out, or nullptr if it is
+*                        not ready yet.
+************************************************************/
+const SolverState* Warmup::tryTake(int length, char duplicates) {
+    int index = settingIndex(length, duplicates);
+    lock_guard<mutex> guard(lock);
+    return (status[index] == READY) ? states[index].get() : nullptr;
+}
+
+/************************************************************
+* FUNCTION: Warmup::settingIndex
+*____________________________________________________________
+* RETURNS:
+*    int: The setting's slot, ordered 4n, 4y, 6n, 6y, 8n, 8y,
+*         which is also the order they are warmed up in.
+************************************************************/
+int Warmup::settingIndex(int length, char duplicates) {
+    return (length - 4) + (tolower(duplicates) == 'y' ? 1 : 0);
+}
+
+/************************************************************
+* FUNCTION: Warmup::stillWanted
+*____________________________________________________________
+* PURPOSE:
+*    Lets the background thread stop between steps once the
+*    setting it is preparing has been cancelled.
+*
+* PARAMETERS:
+*    - int index: The setting being prepared.
+*____________________________________________________________
+* RETURNS:
+*    bool: False if the Warmup is stopping or the setting was
+*          cancelled.
+************************************************************/
+bool Warmup::stillWanted(int index) {
+    lock_guard<mutex> guard(lock);
+    return !stopping && status[index] != CANCELLED;
+}
+
+/************************************************************
+* FUNCTION: Warmup::run
+*____________________________________________________________
+* PURPOSE:
+*    The background thread: takes the first wanted setting,
+*    builds its code space, feedback table, opening guess,
+*    opening split and cached tree with the lock released,
+*    checking for cancellation between steps, then
+*    publishes it. Sleeps when nothing is wanted.
+************************************************************/
+void Warmup::run() {
+    unique_lock<mutex> guard(lock);
+    while (true) {
+        int next = -1;
+        wake.wait(guard, [&]() {
+            for (int i = 0; i < NUM_SETTINGS && next < 0; i++) {
+                if (status[i] == PENDING) next = i;
+            }
+            return stopping || next >= 0;
+        });
+        if (stopping) return;
+
+        status[next] = RUNNING;
+        guard.unlock();
+
+        int length = 4 + 2 * (next / 2);
+        char duplicates = (next % 2 == 1) ? 'y' : 'n';
+        unique_ptr<SolverState> state(new SolverState(length, duplicates));
+
+        bool wanted = stillWanted(next);
+        if (wanted && state->space.size() <= MAX_FEEDBACK_CODES) {
+            state->table.reset(new FeedbackTable(state->space));
+            wanted = stillWanted(next);
+        }
+        if (wanted) {
+            Arena none(nullptr, 0);         // guessFor takes no memory
+            MinimaxStrategy opener(none);
+            opener.useTable(state->table.get());
+            state->opening = opener.guessFor(state->space.begin(),
+                                             state->space.size(), length);
+            wanted = stillWanted(next);
+        }
+        if (wanted) {
+            splitOpening(*state);
+            wanted = stillWanted(next);
+        }
+        if (wanted && state->tree.open(directory + "/" +
+                                       treeCacheName(length, duplicates))) {
+            TreeStrategy check(state->tree);
+            if (!check.reset(state->space)) state->tree.close();
+        }
+
+        guard.lock();
+        // A setting cancelled part way and selected again is redone
+        if (wanted && (status[next] == RUNNING || status[next] == PENDING)) {
+            states[next] = move(state);
+            status[next] = READY;
+        }
+    }
+}
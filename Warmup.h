@@ -0,0 +1,129 @@
+/******************************************
+* Author    : Bryan Estrada               *
+* Teacher   : Dr. Mark Lehr               *
+* Class     : CSC-17C                     *
+* Assignment: Project #1                  *
+* Title     : Mastermind Solver Warmup    *
+******************************************/
+
+#ifndef WARMUP_H
+#define WARMUP_H
+
+//Libraries
+#include "Strategy.h"
+#include "DecisionTree.h"
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//Global Constants
+const int NUM_SETTINGS = 6;         // Code lengths 4, 6, 8 times y/n
+
+/************************************************************
+* STRUCT: SolverState
+*____________________________________________________________
+* PURPOSE:
+*    Everything the solver needs for one setting, prepared
+*    ahead of time.
+*
+* MEMBERS:
+*    - CodeSpace space: Every valid secret.
+*    - std::unique_ptr<FeedbackTable> table: Hint table, for
+*                                            spaces small
+*                                            enough.
+*    - DecisionTree tree: Compiled tree, when a cache file
+*                         for the setting was found.
+*    - Code opening: Minimax's first guess, so the first
+*                    suggestion of a game costs nothing.
+*    - std::vector<Code> split: The space regrouped by the
+*                               hint the opening earns, in
+*                               space order within a group.
+*    - size_t splitBounds[]: Hint index h owns split from
+*                            splitBounds[h] up to
+*                            splitBounds[h + 1].
+************************************************************/
+struct SolverState {
+    SolverState(int length, char duplicates) : space(length, duplicates) {}
+    CodeSpace space;
+    std::unique_ptr<FeedbackTable> table;
+    DecisionTree tree;
+    Code opening = 0;
+    std::vector<Code> split;
+    size_t splitBounds[HINT_SLOTS + 1] = {0};
+};
+
+//Function prototypes
+std::string treeCacheName(int, char);
+bool splitOpening(SolverState&);
+
+/************************************************************
+* CLASS: Advisor
+*____________________________________________________________
+* PURPOSE:
+*    Answers 'suggest' for the player's games. While the
+*    player follows the cached tree, a suggestion is a
+*    lookup. Otherwise a MinimaxStrategy kept for the whole
+*    game narrows its candidates as each turn is played, so
+*    a suggestion only scores what is left. A game opened
+*    with the suggested opening starts from its group of
+*    the precomputed split instead of the whole space. The
+*    arena stays allocated from one game to the next of the
+*    same setting.
+************************************************************/
+class Advisor {
+public:
+    Advisor() : arena(nullptr, 0) {}
+    void newGame(const Game& game);
+    void update(const Game& game);
+    bool suggest(const SolverState& solver, const Game& game, Code& guess);
+private:
+    Advisor(const Advisor&);                // Not copyable
+    Advisor& operator=(const Advisor&);
+    bool follow(const SolverState& solver, const Game& game);
+    const SolverState* current = nullptr;
+    int heldLength = 0;                     // Setting of current
+    bool heldDuplicates = false;
+    std::vector<unsigned char> buffer;
+    Arena arena;
+    std::unique_ptr<MinimaxStrategy> strategy;
+    bool following = false;
+    int seen = 0;
+};
+
+/************************************************************
+* CLASS: Warmup
+*____________________________________________________________
+* PURPOSE:
+*    Prepares a SolverState for each setting on a background
+*    thread, most likely settings first, while the player is
+*    still reading the title and answering the prompts.
+*    select() cancels the settings that will not be played;
+*    tryTake() hands over a prepared state without waiting.
+************************************************************/
+class Warmup {
+public:
+    Warmup();
+    ~Warmup();
+    void start(const std::string& cacheDir);
+    void select(int length, char duplicates);
+    const SolverState* tryTake(int length, char duplicates);
+private:
+    enum Status { PENDING, RUNNING, READY, CANCELLED };
+    Warmup(const Warmup&);                  // Not copyable
+    Warmup& operator=(const Warmup&);
+    static int settingIndex(int length, char duplicates);
+    bool stillWanted(int index);
+    void run();
+    std::string directory;
+    std::mutex lock;
+    std::condition_variable wake;
+    bool stopping;
+    Status status[NUM_SETTINGS];
+    std::unique_ptr<SolverState> states[NUM_SETTINGS];
+    std::thread worker;
+};
+
+#endif /* WARMUP_H */